@@ -4,7 +4,9 @@
  * Mirrors bench_sign.c structure. Key additions:
  *   --signature-mix  {valid|invalid|alternating|random:P}
  *   --invalid-mode   {flip-bit|zero-sig|wrong-key|garbage}
- *   --batch-size N   (default 1; >1 reserved for future batch-verify experiment)
+ *   --batch-size N   (default 1; >1 verifies N items per crypto_verify_many()
+ *                    call from blockchain/src/crypto_backend.c, per-item
+ *                    latency = batch wall time / N)
  *
  * Correctness gate: warmup must prove verify(valid)==TRUE and
  * verify(invalid)==FALSE before the timed region starts. Run aborts otherwise.
@@ -28,6 +30,8 @@
 #include <openssl/evp.h>
 #include <openssl/ec.h>
 
+#include "crypto_backend.h"
+
 /* ── Constants ──────────────────────────────────────────────────────────── */
 
 #define MAX_THREADS      128
@@ -76,7 +80,7 @@ typedef struct {
     int    invalid_mode;
     char   sig_mix_str[32];
     char   invalid_mode_str[32];
-    int    batch_size;         /* currently unused >1; reserved */
+    int    batch_size;         /* items per crypto_verify_many() call; 1 = per-op path */
 } config_t;
 
 /* ── Per-thread ─────────────────────────────────────────────────────────── */
@@ -216,6 +220,45 @@ static int ed25519_verify(const uint8_t *msg, size_t msg_len,
     return ok;
 }
 
+/* ── Batch verify (blockchain crypto_backend) ───────────────────────────── */
+
+typedef struct {
+    uint8_t        *types;
+    const uint8_t **sigs;
+    size_t         *sig_lens;
+    const uint8_t **msgs;
+    size_t         *msg_lens;
+    const uint8_t **pks;
+    size_t         *pk_lens;
+} batch_bufs_t;
+
+static int batch_alloc(batch_bufs_t *b, int n) {
+    b->types    = malloc((size_t)n);
+    b->sigs     = malloc(sizeof(*b->sigs) * (size_t)n);
+    b->sig_lens = malloc(sizeof(size_t) * (size_t)n);
+    b->msgs     = malloc(sizeof(*b->msgs) * (size_t)n);
+    b->msg_lens = malloc(sizeof(size_t) * (size_t)n);
+    b->pks      = malloc(sizeof(*b->pks) * (size_t)n);
+    b->pk_lens  = malloc(sizeof(size_t) * (size_t)n);
+    return b->types && b->sigs && b->sig_lens && b->msgs && b->msg_lens &&
+           b->pks && b->pk_lens;
+}
+
+static void batch_free(batch_bufs_t *b) {
+    free(b->types); free(b->sigs); free(b->sig_lens); free(b->msgs);
+    free(b->msg_lens); free(b->pks); free(b->pk_lens);
+}
+
+static void batch_set(batch_bufs_t *b, int j, uint8_t type,
+                      const uint8_t *sig, size_t sig_len,
+                      const uint8_t *msg, size_t msg_len,
+                      const uint8_t *pk, size_t pk_len) {
+    b->types[j] = type;
+    b->sigs[j] = sig;  b->sig_lens[j] = sig_len;
+    b->msgs[j] = msg;  b->msg_lens[j] = msg_len;
+    b->pks[j]  = pk;   b->pk_lens[j]  = pk_len;
+}
+
 /* ── Worker ─────────────────────────────────────────────────────────────── */
 
 static void *worker(void *arg) {
@@ -238,6 +281,8 @@ static void *worker(void *arg) {
 
     /* -- Keygen (not timed) -- */
     uint8_t *pk = NULL, *sk = NULL;
+    uint8_t ed_pk[32], ed_pk_wrong[32];  /* raw Ed25519 keys for batch path */
+    batch_bufs_t bb = {0};
     OQS_SIG *sig_ctx = NULL;
     EVP_PKEY *evp_pkey = NULL;      /* Ed25519 only */
     EVP_PKEY *evp_pkey_wrong = NULL;/* wrong-key variant */
@@ -259,6 +304,11 @@ static void *worker(void *arg) {
         EVP_PKEY_CTX_free(kctx2);
         sig_len_expected = 64;
         pk_len = 32;
+        size_t raw_len = 32, raw_len_wrong = 32;
+        if (EVP_PKEY_get_raw_public_key(evp_pkey, ed_pk, &raw_len) != 1 ||
+            EVP_PKEY_get_raw_public_key(evp_pkey_wrong, ed_pk_wrong, &raw_len_wrong) != 1) {
+            wa->rc = 1; goto done;
+        }
     } else {
         const char *oqs_name = (cfg->algo == ALGO_FALCON512)
                                 ? OQS_SIG_alg_falcon_512
@@ -392,6 +442,31 @@ static void *worker(void *arg) {
         wa->sink = (uint8_t)res;
     }
 
+    /* -- Batch path setup: same valid/invalid gate through crypto_verify_many -- */
+    uint8_t batch_type = (cfg->algo == ALGO_ED25519)   ? SIG_ED25519
+                       : (cfg->algo == ALGO_FALCON512) ? SIG_FALCON512
+                       :                                 SIG_ML_DSA44;
+    const uint8_t *b_pk       = (cfg->algo == ALGO_ED25519) ? ed_pk : pk;
+    const uint8_t *b_pk_wrong = (cfg->algo == ALGO_ED25519) ? ed_pk_wrong
+                              : (invalid_pk ? invalid_pk : pk);
+
+    if (cfg->batch_size > 1) {
+        if (!batch_alloc(&bb, cfg->batch_size)) { wa->rc = 1; goto done; }
+        uint8_t gate[2];
+        batch_set(&bb, 0, batch_type, valid_sig, actual_sig_len, msg, msg_len, b_pk, pk_len);
+        if (cfg->invalid_mode == INV_WRONG_KEY)
+            batch_set(&bb, 1, batch_type, valid_sig, actual_sig_len, msg, msg_len, b_pk_wrong, pk_len);
+        else
+            batch_set(&bb, 1, batch_type, invalid_sig, actual_sig_len, msg, msg_len, b_pk, pk_len);
+        crypto_verify_many(bb.types, bb.sigs, bb.sig_lens, bb.msgs, bb.msg_lens,
+                           bb.pks, bb.pk_lens, 2, gate);
+        if (gate[0] != 1 || gate[1] != 0) {
+            fprintf(stderr, "[t%d run%d] ABORT: crypto_verify_many gate returned "
+                    "valid=%d invalid=%d\n", tid, run, gate[0], gate[1]);
+            wa->rc = 2; goto done;
+        }
+    }
+
     /* -- Barrier: all threads ready -- */
     pthread_barrier_wait(&g_barrier);
 
@@ -399,7 +474,37 @@ static void *worker(void *arg) {
     long expected_t, expected_f;
     expected_counts(cfg, cfg->iterations, &expected_t, &expected_f);
 
-    for (long i = 0; i < cfg->iterations; i++) {
+    /* Batched: one crypto_verify_many() per batch_size items; the batch wall
+     * time is spread evenly over its items in latency_ns[]. */
+    for (long i = 0; cfg->batch_size > 1 && i < cfg->iterations; i += cfg->batch_size) {
+        long nb = cfg->iterations - i;
+        if (nb > cfg->batch_size) nb = cfg->batch_size;
+
+        for (long j = 0; j < nb; j++) {
+            int inv = is_invalid_iter(cfg, tid, i + j);
+            wa->was_valid_arr[i + j] = (uint8_t)(!inv);
+            if (inv && cfg->invalid_mode == INV_WRONG_KEY)
+                batch_set(&bb, (int)j, batch_type, valid_sig, actual_sig_len, msg, msg_len, b_pk_wrong, pk_len);
+            else if (inv)
+                batch_set(&bb, (int)j, batch_type, invalid_sig, actual_sig_len, msg, msg_len, b_pk, pk_len);
+            else
+                batch_set(&bb, (int)j, batch_type, valid_sig, actual_sig_len, msg, msg_len, b_pk, pk_len);
+        }
+
+        asm volatile("" ::: "memory");
+        uint64_t t0 = now_ns();
+        crypto_verify_many(bb.types, bb.sigs, bb.sig_lens, bb.msgs, bb.msg_lens,
+                           bb.pks, bb.pk_lens, (size_t)nb, &wa->result_arr[i]);
+        uint64_t t1 = now_ns();
+        asm volatile("" ::: "memory");
+
+        for (long j = 0; j < nb; j++) {
+            wa->latency_ns[i + j] = (t1 - t0) / (uint64_t)nb;
+            if (wa->result_arr[i + j]) wa->n_true++; else wa->n_false++;
+        }
+    }
+
+    for (long i = 0; cfg->batch_size == 1 && i < cfg->iterations; i++) {
         int inv = is_invalid_iter(cfg, tid, i);
         wa->was_valid_arr[i] = (uint8_t)(!inv);
 
@@ -457,6 +562,8 @@ static void *worker(void *arg) {
     }
 
 done:
+    batch_free(&bb);
+    crypto_thread_cleanup();
     if (sig_ctx)        OQS_SIG_free(sig_ctx);
     if (evp_pkey)       EVP_PKEY_free(evp_pkey);
     if (evp_pkey_wrong) EVP_PKEY_free(evp_pkey_wrong);
@@ -647,7 +754,7 @@ static void usage(const char *argv0) {
         "  --tag             free-text label\n"
         "  --signature-mix   valid|invalid|alternating|random:P  [default valid]\n"
         "  --invalid-mode    flip-bit|zero-sig|wrong-key|garbage [default flip-bit]\n"
-        "  --batch-size N    reserved; must be 1             [default 1]\n",
+        "  --batch-size N    items per crypto_verify_many() [default 1 = per-op]\n",
         argv0);
 }
 
@@ -761,7 +868,7 @@ static int parse_args(int argc, char **argv, config_t *cfg) {
     if (cfg->algo < 0)         { fprintf(stderr, "--algo is required\n"); return 0; }
     if (cfg->n_threads <= 0)   { fprintf(stderr, "--threads is required and must be >0\n"); return 0; }
     if (cfg->output_prefix[0] == '\0') { fprintf(stderr, "--output-prefix is required\n"); return 0; }
-    if (cfg->batch_size != 1)  { fprintf(stderr, "--batch-size must be 1 (batched verify not yet implemented)\n"); return 0; }
+    if (cfg->batch_size < 1)   { fprintf(stderr, "--batch-size must be >= 1\n"); return 0; }
 
     /* Assign CPU IDs */
     if (cfg->n_explicit_cpus >= cfg->n_threads) {
@@ -792,9 +899,9 @@ int main(int argc, char **argv) {
     memset(&cfg, 0, sizeof(cfg));
     if (!parse_args(argc, argv, &cfg)) { usage(argv[0]); return 1; }
 
-    printf("bench_verify: algo=%s threads=%d pin=%s mix=%s iters=%ld warmup=%ld runs=%d\n",
+    printf("bench_verify: algo=%s threads=%d pin=%s mix=%s iters=%ld warmup=%ld runs=%d batch=%d\n",
            cfg.algo_str, cfg.n_threads, cfg.pin_strategy_str,
-           cfg.sig_mix_str, cfg.iterations, cfg.warmup, cfg.runs);
+           cfg.sig_mix_str, cfg.iterations, cfg.warmup, cfg.runs, cfg.batch_size);
 
     worker_args_t wa[MAX_THREADS];
     pthread_t     threads[MAX_THREADS];
@@ -44,4 +44,19 @@ void blake3(const uint8_t *input, size_t input_len, uint8_t output[BLAKE3_OUT_LE
 // Hash with truncation
 void blake3_truncated(const uint8_t *input, size_t input_len, uint8_t *output, size_t out_len);
 
+// Hash num_inputs messages of input_len bytes each; output i is written to
+// out + i * out_len. Same result as blake3_truncated() per message. Messages
+// up to BLAKE3_CHUNK_LEN bytes with out_len <= BLAKE3_OUT_LEN go through
+// 4/8/16-lane SIMD kernels (SSE4.1 / AVX2 / AVX-512 picked at runtime).
+void blake3_hash_many(const uint8_t *const *inputs, size_t num_inputs, size_t input_len,
+                      uint8_t *out, size_t out_len);
+
+// Kernel blake3_hash_many() dispatches to ("avx512", "avx2", "sse4.1",
+// "portable" or "scalar") and the messages it hashes per call
+const char *blake3_simd_name(void);
+size_t blake3_simd_lanes(void);
+
+// Cap the kernel width (1 = scalar only), e.g. to compare kernels
+void blake3_set_simd_max_lanes(size_t max_lanes);
+
 #endif // BLAKE3_H
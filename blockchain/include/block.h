@@ -4,7 +4,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "transaction.h"
+#include "tx_arena.h"
 #include "consensus.h"
+#include "merkle.h"
 
 // =============================================================================
 // BLOCK STRUCTURE
@@ -30,25 +32,47 @@ typedef struct {
 
 #pragma pack(pop)
 
+// The TX pointer array is sized to the block: empty blocks have none, adds
+// grow it geometrically (up to MAX_TRANSACTIONS_PER_BLOCK), block_reserve()
+// sizes it up front when the count is known, and block_compact() trims it
+// once the block is complete. tx_capacity >= header.transaction_count.
 typedef struct {
     BlockHeader header;
-    Transaction** transactions;     // Array of transaction pointers
+    TxView** transactions;          // Array of TX record pointers (into arena)
+    TxArena* arena;                 // Owns every TX record of this block
     uint64_t total_fees;            // Sum of all transaction fees
+    uint32_t tx_capacity;           // Allocated entries in transactions[]
+    MerkleTree* merkle;             // TX tree while building (NULL once compacted)
 } Block;
 
 // =============================================================================
 // BLOCK FUNCTIONS
 // =============================================================================
 
-// Create empty block
+// Create empty block (no TX array until the first add)
 Block* block_create(void);
 
 // Create genesis block
 Block* block_create_genesis(void);
 
-// Add transaction to block
+// Add transaction to block (compact copy into the block's arena)
 bool block_add_transaction(Block* block, Transaction* tx);
 
+// Add an existing view to block (copied into the block's arena)
+bool block_add_tx_view(Block* block, const TxView* tx);
+
+// Make room for count TXs in total (new slots are NULL); false if count
+// exceeds MAX_TRANSACTIONS_PER_BLOCK
+bool block_reserve(Block* block, uint32_t count);
+
+// Shrink-to-fit once a block is sealed: the TX pointer array is trimmed to
+// header.transaction_count and the cached TX tree is freed (TXs can still be
+// added afterwards, at the cost of a regrow and a full rehash)
+void block_compact(Block* block);
+
+// Deep copy, sized to fit; empty TX slots are kept as they are
+Block* block_copy(const Block* block);
+
 // Calculate total fees in block
 uint64_t block_calculate_fees(const Block* block);
 
@@ -56,17 +80,41 @@ uint64_t block_calculate_fees(const Block* block);
 void block_set_proof(Block* block, const SpaceProof* proof, 
                      const uint8_t farmer_address[20]);
 
-// Calculate block hash
+// Calculate block hash: SHA256(header fields || Merkle root of the TXs).
+// Builds / extends the block's cached tree: only TXs added since the
+// previous call are hashed again.
 void block_calculate_hash(Block* block);
 
-// Verify block integrity
+// Merkle root over the block's TX hashes: read from the cached tree if it is
+// current, else from a temporary one (the block is not modified)
+void block_tx_root(const Block* block, uint8_t root[32]);
+
+// A TX at index was modified in place after the block was hashed: refresh
+// its leaf and path in the cached tree
+void block_tx_changed(Block* block, uint32_t index);
+
+// Inclusion proof for the TX at index (rebuilds the tree if none is cached)
+bool block_tx_proof(const Block* block, uint32_t index, MerkleProof* proof);
+
+// Check that tx_hash is in the block with this header, from the proof alone
+// (no TXs needed: light clients)
+bool block_verify_tx_proof(const BlockHeader* header, const uint8_t tx_hash[TX_HASH_SIZE],
+                           const MerkleProof* proof);
+
+// Verify block integrity: linkage to prev_block, every TX the header counts
+// present, and the header hash
 bool block_verify(const Block* block, const Block* prev_block);
 
 // =============================================================================
 // SERIALIZATION (Protobuf-based)
 // =============================================================================
 
-// Serialize block to protobuf binary (caller must free, returns size)
+// Include full signature + public key in block_serialize_pb (default: off,
+// 64-byte signature prefix only). Deserialization accepts either form.
+void block_set_pb_full_signatures(bool enabled);
+
+// Serialize block to protobuf binary (caller must free, returns size); empty
+// TX slots are skipped
 uint8_t* block_serialize_pb(const Block* block, size_t* out_len);
 
 // Deserialize block from protobuf binary
@@ -86,7 +134,7 @@ void block_destroy(Block* block);
 // =============================================================================
 
 // Get coinbase transaction (first tx in block)
-Transaction* block_get_coinbase(const Block* block);
+TxView* block_get_coinbase(const Block* block);
 
 // Check if block has valid proof of space
 bool block_has_valid_proof(const Block* block);
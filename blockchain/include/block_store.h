@@ -0,0 +1,105 @@
+#ifndef BLOCK_STORE_H
+#define BLOCK_STORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "block.h"
+
+// =============================================================================
+// SEGMENTED ON-DISK BLOCK STORE
+// =============================================================================
+//
+// Append-only log of protobuf-serialized blocks, split into segment files
+// inside one directory:
+//
+//   <dir>/seg_000000.dat, seg_000001.dat, ...
+//
+// Each segment is a sequence of records, and a record never spans two files:
+//
+//   [4] magic "QBLK"   [4] payload length   [8] height   [payload]
+//
+// Heights are dense and start at 0, so the in-memory index is a flat array
+// indexed by height (12 bytes per block). Reads mmap the segment holding
+// the block (at most BLOCK_STORE_MAX_MAPPED segments stay mapped, least
+// recently used is unmapped first) and deserialize only that record.
+// Deserialized blocks live in a small round-robin cache owned by the store.
+//
+// On open, existing segments are scanned to rebuild the index; a torn
+// record at the tail (crash mid-append) is cut off.
+//
+// Appends go to the page cache; block_store_sync() makes everything appended
+// so far durable with one fdatasync (group commit). Rolling to a new segment
+// syncs the old one and the directory entry of the new one.
+// =============================================================================
+
+#define BLOCK_STORE_SEGMENT_BYTES  (64u * 1024 * 1024)   // Roll to a new file past this
+#define BLOCK_STORE_MAX_MAPPED     8                     // Segments mapped at once
+#define BLOCK_STORE_COLD_CACHE     4                     // Deserialized cold blocks kept
+#define BLOCK_STORE_DEFAULT_HOT    64                    // Blockchain hot window default
+
+typedef struct {
+    uint32_t segment;
+    uint32_t offset;                       // Payload offset within the segment
+    uint32_t length;                       // Payload bytes
+} BlockStoreIndex;
+
+typedef struct {
+    uint8_t* base;                         // NULL = slot unused
+    size_t length;                         // Mapped bytes (file size at map time)
+    uint32_t segment;
+    uint64_t last_use;
+} BlockStoreMap;
+
+typedef struct {
+    char* dir;
+    int fd;                                // Current (append) segment
+    uint32_t segment;                      // Current segment number
+    uint64_t segment_bytes;                // Bytes in the current segment
+
+    BlockStoreIndex* index;                // index[height]
+    uint64_t count;                        // Stored blocks (= next height)
+    uint64_t synced_count;                 // Blocks known to be on stable storage
+    uint64_t capacity;
+
+    BlockStoreMap maps[BLOCK_STORE_MAX_MAPPED];
+    uint64_t map_clock;
+
+    Block* cold[BLOCK_STORE_COLD_CACHE];   // Blocks handed out by block_store_get()
+    uint64_t cold_height[BLOCK_STORE_COLD_CACHE];
+    uint32_t cold_next;
+
+    uint64_t bytes_written;                // Payload + record headers since open
+} BlockStore;
+
+// Open (creating the directory if needed) and index existing segments
+BlockStore* block_store_open(const char* dir);
+
+// Append the block at height block_store_height(); false on I/O error
+bool block_store_append(BlockStore* store, const Block* block);
+
+// Append an already-serialized block (block_serialize_pb output)
+bool block_store_append_raw(BlockStore* store, uint64_t height,
+                            const uint8_t* data, size_t len);
+
+// Number of stored blocks
+uint64_t block_store_height(const BlockStore* store);
+
+// Flush every appended block to stable storage
+bool block_store_sync(BlockStore* store);
+
+// Serialized bytes of a stored block, pointing into a read-only mapping.
+// Valid until BLOCK_STORE_MAX_MAPPED other segments have been read, or the
+// store is truncated or closed.
+const uint8_t* block_store_get_raw(BlockStore* store, uint64_t height, size_t* len);
+
+// Deserialized block, owned by the store's cold cache: valid until
+// BLOCK_STORE_COLD_CACHE further cache misses, truncate, or close.
+Block* block_store_get(BlockStore* store, uint64_t height);
+
+// Drop every block at height >= height
+bool block_store_truncate(BlockStore* store, uint64_t height);
+
+void block_store_close(BlockStore* store);
+
+#endif // BLOCK_STORE_H
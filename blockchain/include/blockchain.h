@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "block.h"
+#include "block_store.h"
 #include "transaction.h"
 
 // =============================================================================
@@ -12,28 +13,72 @@
 
 // Maximum number of blocks the chain can hold in memory.
 // At 1 block/6 seconds: ~100K blocks = ~7 days of continuous operation.
-// For production use, blocks beyond this limit would need paging to disk.
+// With a block store attached (blockchain_attach_store) there is no limit:
+// only the last hot_window blocks stay resident, older ones are read back
+// from the store's segment files.
 #define MAX_BLOCKS 100000
 
 typedef struct {
-    Block** blocks;
+    uint8_t address[20];
+    uint64_t balance;
+    uint64_t nonce;            // Next expected TX nonce (prevents replay attacks)
+} LedgerAccount;
+
+#define LEDGER_GROUP_SLOTS     16        // Tags compared per probe step
+#define LEDGER_INITIAL_SLOTS   1024
+
+// Blocks with fewer TXs are applied on the calling thread only
+#define PARALLEL_APPLY_MIN_TXS 4096
+
+// Persistence defaults with a block store attached
+#define BLOCKCHAIN_SYNC_BLOCKS      16     // fdatasync at least every N blocks
+#define BLOCKCHAIN_SYNC_MS          200    // ...or once the oldest unsynced block is this old
+#define BLOCKCHAIN_SNAPSHOT_BLOCKS  1000   // Ledger snapshot every N blocks (0 = never)
+
+typedef struct {
+    Block** blocks;           // [height] in memory; ring of hot_window with a store
     uint64_t height;
     uint8_t last_hash[32];    // Cached hash of most recent block (avoids full chain walk)
 
-    // Ledger: flat array mapping address → {balance, nonce}.
-    //
-    // IMPLEMENTATION NOTE: Linear search O(n) via find_ledger_entry().
-    // This is acceptable for benchmarks with ≤10K distinct senders.
-    // For production, replace with a hash map (e.g., uthash or khash) to get O(1).
+    // Ledger: dense account array + open-addressing index keyed by address.
     //
-    // 10000-entry cap: at 20 bytes/address + 16 bytes state = 360KB — fits in L2.
-    // A real blockchain (e.g., Ethereum) uses a Patricia Merkle Trie for this.
-    struct {
-        uint8_t address[20];
-        uint64_t balance;
-        uint64_t nonce;        // Next expected TX nonce (prevents replay attacks)
-    } ledger[10000];
+    // ledger[0..ledger_count) holds accounts in creation order (iteration,
+    // save/load and printing walk it directly). ledger_ctrl / ledger_slots
+    // form the index: slots are grouped LEDGER_GROUP_SLOTS at a time, each
+    // with a one-byte control tag (0 = empty, 0x80 | 7 hash bits = used), so
+    // one probe step compares a whole group of tags with a single SSE2
+    // compare and only touches ledger[] on a tag match. Both arrays double
+    // when the index passes 7/8 load; there is no account cap.
+    LedgerAccount* ledger;
     uint32_t ledger_count;
+    uint32_t ledger_capacity;     // Allocated entries in ledger[]
+    uint8_t* ledger_ctrl;         // Control tag per slot
+    uint32_t* ledger_slots;       // Slot → ledger[] index (valid when ctrl != 0)
+    uint32_t ledger_slot_count;   // Power of two, multiple of LEDGER_GROUP_SLOTS
+
+    // Parallel block apply (see blockchain_process_block); scratch is reused
+    // across blocks
+    bool parallel_apply;
+    struct ApplyScratch* apply_scratch;
+
+    // Signature re-check on accept (see blockchain_set_require_full_sigs):
+    // non-coinbase TXs re-verified, and accepted without signature material
+    bool require_full_sigs;
+    uint64_t sigs_checked;
+    uint64_t sigs_unchecked;
+
+    BlockStore* store;        // NULL = every block stays in memory
+    uint32_t hot_window;      // Resident blocks when store != NULL
+
+    // Crash-safe persistence (store != NULL): the store is the write-ahead
+    // log, synced in groups; the ledger is snapshotted every snapshot_blocks
+    // blocks so a restart replays only the blocks after the last snapshot.
+    uint32_t sync_blocks;
+    uint32_t sync_interval_ms;
+    uint32_t snapshot_blocks;
+    uint32_t unsynced_blocks;
+    uint64_t first_unsynced_ms;   // Accept time of the oldest unsynced block
+    uint64_t snapshot_height;     // Chain height covered by the last snapshot
 } Blockchain;
 
 // =============================================================================
@@ -43,10 +88,19 @@ typedef struct {
 // Create new blockchain (with genesis block)
 Blockchain* blockchain_create(void);
 
-// Add block to chain
+// Add block to chain (the chain keeps its own copy)
 bool blockchain_add_block(Blockchain* bc, Block* block);
 
-// Get block by height
+// Add block to chain without copying it: on success the chain owns block
+// (compacted with block_compact; it stays valid until it leaves the hot
+// window or the chain is destroyed), on failure the caller still does.
+// raw / raw_len, if given, is the block's protobuf encoding: with a store
+// attached it is logged as-is instead of being re-serialized.
+bool blockchain_adopt_block(Blockchain* bc, Block* block, const uint8_t* raw, size_t raw_len);
+
+// Get block by height. With a block store, heights outside the hot window
+// are loaded from disk into the store's cold cache (see block_store_get for
+// how long the pointer stays valid).
 Block* blockchain_get_block(const Blockchain* bc, uint64_t height);
 
 // Get last block
@@ -55,6 +109,40 @@ Block* blockchain_get_last_block(const Blockchain* bc);
 // Get current height
 uint64_t blockchain_get_height(const Blockchain* bc);
 
+// Move block storage to a segmented on-disk store in dir: every accepted
+// block is appended there, and only the last hot_blocks blocks stay in
+// memory (0 = BLOCK_STORE_DEFAULT_HOT). A store holding another chain is
+// reset; the current blocks are written out first.
+bool blockchain_attach_store(Blockchain* bc, const char* dir, uint32_t hot_blocks);
+
+// Open the chain persisted in dir: load the newest valid ledger snapshot and
+// replay only the stored blocks after it. A torn or invalid tail is cut off.
+// An empty directory starts a new chain (blockchain_create + attach).
+Blockchain* blockchain_open(const char* dir, uint32_t hot_blocks);
+
+// Group commit / snapshot tuning (0 disables the respective trigger;
+// sync_blocks = 1 syncs every block before blockchain_add_block returns).
+// A block is durable once unsynced_blocks is 0; acks that promise
+// durability must wait for that.
+void blockchain_set_persistence(Blockchain* bc, uint32_t sync_blocks,
+                                uint32_t sync_interval_ms, uint32_t snapshot_blocks);
+
+// Make every accepted block durable
+bool blockchain_sync(Blockchain* bc);
+
+// Sync if the block-count or age threshold has been reached; cheap enough to
+// call from an idle loop
+bool blockchain_sync_if_due(Blockchain* bc);
+
+// Sync, then write a ledger snapshot at the current height next to the
+// segments (ledger_<height>.snap, written via rename; older ones pruned)
+bool blockchain_snapshot(Blockchain* bc);
+
+// Snapshot once snapshot_blocks blocks have been added since the last one.
+// Not called by blockchain_add_block: the write is synchronous (36 B per
+// account, ~36 MB for 1M accounts), so callers run it between requests.
+bool blockchain_snapshot_if_due(Blockchain* bc);
+
 // Get balance for address
 uint64_t blockchain_get_balance(const Blockchain* bc, const uint8_t address[20]);
 
@@ -73,6 +161,18 @@ void blockchain_update_nonce(Blockchain* bc, const uint8_t address[20],
 // Process block transactions (update ledger)
 bool blockchain_process_block(Blockchain* bc, const Block* block);
 
+// Apply blocks of PARALLEL_APPLY_MIN_TXS+ TXs with OpenMP: senders are
+// grouped and debited concurrently, credits reduced per destination. The
+// resulting ledger and log output are identical to the sequential loop.
+// Enabled by default.
+void blockchain_set_parallel_apply(Blockchain* bc, bool enabled);
+
+// Accepted blocks have every non-coinbase TX that carries a public key and
+// full signature (validator --full-sigs) re-verified. Legacy TXs (64-byte
+// prefix, no key) pass unchecked and are counted in sigs_unchecked; with
+// enabled, a block containing any such TX is rejected instead. Default: off.
+void blockchain_set_require_full_sigs(Blockchain* bc, bool enabled);
+
 // Verify entire chain
 bool blockchain_verify(const Blockchain* bc);
 
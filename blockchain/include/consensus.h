@@ -19,6 +19,10 @@
 //   nonce[4]  = 4 bytes  - Original index/nonce
 //   hash[28]  = 28 bytes - Truncated BLAKE3 hash value
 //   TOTAL     = 32 bytes
+//
+// Compact entries: 12 bytes each (see plot_set_compact)
+//   prefix[8] = 8 bytes  - Leading bytes of the hash (sort key)
+//   nonce[4]  = 4 bytes  - Full hash is recomputed as BLAKE3(plot_id || nonce)
 // =============================================================================
 
 #pragma pack(push, 1)
@@ -29,9 +33,16 @@ typedef struct {
     uint8_t hash[28];    // 28 bytes: Truncated BLAKE3 hash
 } PlotEntry;             // TOTAL: 32 bytes
 
+// Compact plot entry: 12 bytes
+typedef struct {
+    uint8_t prefix[8];   // 8 bytes: Leading bytes of the hash
+    uint32_t nonce;      // 4 bytes: Original position/nonce
+} PlotCompactEntry;      // TOTAL: 12 bytes
+
 #pragma pack(pop)
 
 _Static_assert(sizeof(PlotEntry) == 32, "PlotEntry must be exactly 32 bytes");
+_Static_assert(sizeof(PlotCompactEntry) == 12, "PlotCompactEntry must be exactly 12 bytes");
 
 // =============================================================================
 // PLOT STRUCTURE
@@ -40,10 +51,16 @@ _Static_assert(sizeof(PlotEntry) == 32, "PlotEntry must be exactly 32 bytes");
 typedef struct {
     uint8_t plot_id[32];        // Unique plot identifier
     uint8_t farmer_address[20]; // Owner's address
-    PlotEntry* entries;         // Sorted array of entries
+    PlotEntry* entries;         // Sorted array of entries (NULL for compact plots)
+    PlotCompactEntry* compact;  // Sorted compact entries (NULL for full plots)
     uint64_t entry_count;       // Number of entries (2^k)
     uint32_t k_param;           // k parameter
     bool is_sorted;             // Whether entries are sorted
+    void* map_base;             // Plot file mapping entries point into (NULL = heap)
+    size_t map_length;
+    uint32_t* index;            // Prefix index over sorted entries (NULL = none)
+    uint32_t index_bits;        // Hash bits the index is keyed by
+    bool index_mapped;          // index points into map_base
 } Plot;
 
 // =============================================================================
@@ -107,8 +124,19 @@ typedef struct {
 #define K_PARAM_MAX         30       // 2^30 = 1 billion entries
 
 #define PLOT_ENTRY_SIZE     32
+#define PLOT_COMPACT_PREFIX 8        // Hash bytes kept per compact entry
 #define PROOF_HASH_SIZE     28
 #define QUALITY_SIZE        32
+#define PLOT_HASH_BATCH     16       // Nonces per blake3_hash_many() call
+#define PLOT_PROGRESS_STEP  65536    // Entries a thread hashes between progress updates
+#define PLOT_SORT_SMALL     32       // Radix sort buckets this small use insertion sort
+#define PLOT_INDEX_BUCKET   8        // Target entries per prefix index bucket
+#define PLOT_INDEX_MIN_BITS 16
+#define PLOT_INDEX_MAX_BITS 24
+#define PLOT_SEARCH_THREADS 32       // Plots plot_find_proof_many() searches at once
+#define PLOT_STREAM_MEMORY_DEFAULT (1ULL << 30)  // plot_generate_to_file() budget if none set
+#define PLOT_STREAM_MAX_RUNS 512     // Sorted runs (open temp files) in one merge
+#define PLOT_STREAM_MIN_BUFFER 4096  // Entries per merge buffer, whatever the budget
 
 // =============================================================================
 // PLOT FUNCTIONS
@@ -117,25 +145,67 @@ typedef struct {
 // Create new plot with k parameter
 Plot* plot_create(const uint8_t farmer_address[20], uint32_t k_param);
 
+// Threads for plot_generate() and plot_sort() (0 = one per core)
+void plot_set_threads(uint32_t threads);
+uint32_t plot_get_threads(void);
+
+// Make plot_create() allocate compact entries (8-byte hash prefix + nonce,
+// 12 bytes instead of 32). plot_find_proof() recomputes the full hash of
+// the few entries it examines, so proofs are the same as from a full plot.
+void plot_set_compact(bool compact);
+
 // Generate plot entries using BLAKE3(plot_id || i)
 bool plot_generate(Plot* plot);
 
-// Sort plot entries by hash (required before binary search)
+// Generate a sorted plot straight into a plot file without holding it in
+// memory: sorted runs spilled to temp files next to path, then a k-way
+// merge into the file (see STREAMING PLOT GENERATION). Honors
+// plot_set_compact() and plot_set_threads(). Load it with
+// plot_load_from_file().
+bool plot_generate_to_file(const uint8_t farmer_address[20], uint32_t k_param,
+                           const char* path);
+
+// Memory plot_generate_to_file() may use for runs and merge buffers, in
+// bytes (0 = PLOT_STREAM_MEMORY_DEFAULT); the prefix index comes on top
+void plot_set_memory_limit(uint64_t bytes);
+uint64_t plot_get_memory_limit(void);
+
+// Sort plot entries by hash (required before binary search). Parallel
+// radix sort on the leading hash bytes; needs a scratch copy of the entries
+// and falls back to qsort if that cannot be allocated.
 void plot_sort(Plot* plot);
 
+// (Re)build the prefix index of a sorted plot; plot_sort() does this
+void plot_build_index(Plot* plot);
+
 // Persist plot to disk (binary format with magic header).
 // Returns true on success.
 bool plot_save_to_file(const Plot* plot, const char* path);
 
 // Load plot from disk. Returns NULL on missing/corrupt file.
 // Caller owns the returned Plot* and must call plot_destroy().
+// Sorted version 2 files are mapped read-only instead of read (see
+// plot_set_load_mode); such a plot's entries must not be modified.
 Plot* plot_load_from_file(const char* path);
 
+// How plot_load_from_file() brings in a sorted plot
+#define PLOT_LOAD_MMAP      0        // Map, pages fault in on first probe (default)
+#define PLOT_LOAD_POPULATE  1        // Map and prefault the whole file (MAP_POPULATE)
+#define PLOT_LOAD_RANDOM    2        // Map with madvise(MADV_RANDOM): no readahead
+#define PLOT_LOAD_HEAP      3        // Read into a private heap copy
+void plot_set_load_mode(uint32_t mode);
+
 // Find best proof for a challenge using binary search
 SpaceProof* plot_find_proof(const Plot* plot, 
                             const uint8_t challenge[32],
                             uint32_t difficulty);
 
+// Search several plots in parallel and return the best proof across all
+// of them (NULL if none meets difficulty)
+SpaceProof* plot_find_proof_many(Plot* const* plots, uint32_t count,
+                                 const uint8_t challenge[32],
+                                 uint32_t difficulty);
+
 // Verify a space proof
 bool proof_verify(const SpaceProof* proof,
                   const uint8_t challenge[32],
@@ -188,7 +258,8 @@ void difficulty_record_winner(DifficultyState* state, bool had_winner);
 // Comparison function for qsort (compare by hash)
 int plot_entry_compare(const void* a, const void* b);
 
-// Binary search for entries below target
+// Binary search for the entry closest to target (full plots only;
+// NULL for compact plots, which have no stored hashes to point at)
 PlotEntry* plot_binary_search(const Plot* plot, 
                               const uint8_t target[28],
                               uint64_t* found_count);
@@ -105,17 +105,44 @@ bool crypto_verify(crypto_ctx_t *ctx,
                    const uint8_t *pubkey, size_t pubkey_len);
 
 /**
- * Stateless verify dispatching by sig_type. Creates a temporary context,
- * verifies, and frees it. Used for TX verification in OpenMP loops.
+ * Verify dispatching by sig_type. liboqs schemes reuse a per-thread verifier
+ * context (created on first use, freed by crypto_thread_cleanup()).
+ * Re-entrant; used for TX verification in OpenMP loops.
  */
 bool crypto_verify_typed(uint8_t sig_type,
                          const uint8_t *sig, size_t sig_len,
                          const uint8_t *msg, size_t msg_len,
                          const uint8_t *pubkey, size_t pubkey_len);
 
+/**
+ * Verify n independent signatures, amortizing per-call setup across them.
+ * results[i] is set to 1 (valid) or 0 (invalid) for every item; a NULL sig or
+ * pubkey marks that item invalid. Returns true only if all n items verified.
+ * Each item gets the same verdict crypto_verify_typed() would give it.
+ *
+ * Not a batch verifier: OpenSSL EVP has no batch primitive, so there is no
+ * randomized Ed25519 batch equation and no bisection fallback. Items are
+ * checked one by one and only context / key setup is amortized, hence the
+ * name crypto_verify_many() rather than crypto_verify_batch().
+ */
+bool crypto_verify_many(const uint8_t *sig_types,
+                        const uint8_t *const *sigs, const size_t *sig_lens,
+                        const uint8_t *const *msgs, const size_t *msg_lens,
+                        const uint8_t *const *pubkeys, const size_t *pubkey_lens,
+                        size_t n, uint8_t *results);
+
+/**
+ * Decoded public-key cache counters (process-wide, thread-safe). Ed25519
+ * verifies reuse cached EVP_PKEYs for repeat senders; liboqs schemes take
+ * raw key bytes and bypass the cache.
+ */
+void crypto_pubkey_cache_stats(uint64_t *hits, uint64_t *misses);
+
 /* ------------------------------------------------------------------ */
 /* Thread cleanup (call before thread exit in Falcon/ML-DSA builds)   */
 /* ------------------------------------------------------------------ */
+
+/** Free the calling thread's cached verifiers and stop liboqs thread state. */
 void crypto_thread_cleanup(void);
 
 #endif /* CRYPTO_BACKEND_H */
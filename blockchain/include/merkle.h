@@ -0,0 +1,85 @@
+#ifndef MERKLE_H
+#define MERKLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "transaction.h"
+
+// =============================================================================
+// BINARY MERKLE TREE OVER TX HASHES
+// =============================================================================
+//
+//   leaf     = BLAKE3(0x00 || tx_hash[28])
+//   interior = BLAKE3(0x01 || left[32] || right[32])
+//
+// The prefixes keep a leaf from ever being read as an interior node. A level
+// with an odd node count promotes its last node unchanged to the next level
+// (no duplication, so two different TX lists never share a root). An empty
+// tree has an all-zero root.
+//
+// Every level is kept, so the tree doubles as a cache: leaves and interior
+// nodes are only recomputed from the first dirty leaf onwards. Appending k
+// leaves to an n-leaf tree costs k leaf hashes plus about k + log2(n)
+// interior hashes. Nodes are hashed 16 at a time with the SIMD
+// blake3_hash_many(), and wide levels are split across OpenMP threads.
+//
+// An inclusion proof is the sibling on each level where the path has one.
+// Verifying it needs only the leaf's TX hash, the proof and the root.
+// =============================================================================
+
+#define MERKLE_HASH_SIZE     32
+#define MERKLE_MAX_LEVELS    32          // Enough for 2^31 leaves
+#define MERKLE_PARALLEL_MIN  2048        // Nodes per level before OpenMP kicks in
+
+typedef struct {
+    uint32_t leaf_count;                 // Leaves the tree holds
+    uint32_t capacity;                   // Leaves allocated for
+    uint32_t dirty_from;                 // First leaf whose path is stale
+    uint32_t levels;                     // Levels in use (1 = just the leaves)
+    uint8_t (*nodes[MERKLE_MAX_LEVELS])[MERKLE_HASH_SIZE];   // nodes[0] = leaves
+} MerkleTree;
+
+typedef struct {
+    uint32_t index;                      // Leaf position
+    uint32_t leaf_count;                 // Leaves in the tree (fixes the shape)
+    uint32_t sibling_count;
+    uint8_t siblings[MERKLE_MAX_LEVELS][MERKLE_HASH_SIZE];   // Bottom-up
+} MerkleProof;
+
+MerkleTree* merkle_create(void);
+void merkle_destroy(MerkleTree* tree);
+
+// Leaf hash of one TX hash
+void merkle_leaf_hash(const uint8_t tx_hash[TX_HASH_SIZE], uint8_t out[MERKLE_HASH_SIZE]);
+
+// Leaf hashes of count consecutive TX hashes into count consecutive nodes
+// (batched through blake3_hash_many)
+void merkle_leaf_hash_many(const uint8_t* tx_hashes, uint32_t count, uint8_t* out);
+
+// Grow or shrink to count leaves. New leaves are uninitialized and must be
+// written (merkle_leaf) before the next merkle_root.
+void merkle_resize(MerkleTree* tree, uint32_t count);
+
+// Writable leaf slot; the caller stores a merkle_leaf_hash there
+uint8_t* merkle_leaf(MerkleTree* tree, uint32_t index);
+
+// Leaf index was rewritten in place. An up-to-date tree rehashes the path to
+// the root right away (log2(n) hashes); otherwise the leaf joins the dirty
+// range handled by the next merkle_root.
+void merkle_leaf_changed(MerkleTree* tree, uint32_t index);
+
+// Bring the dirty part of the tree up to date and return the root
+void merkle_root(MerkleTree* tree, uint8_t root[MERKLE_HASH_SIZE]);
+
+// Root of an up-to-date, non-empty tree without touching it; false if
+// merkle_root would have to rehash first
+bool merkle_cached_root(const MerkleTree* tree, uint8_t root[MERKLE_HASH_SIZE]);
+
+// Inclusion proof for leaf index (the tree must be up to date)
+bool merkle_proof(const MerkleTree* tree, uint32_t index, MerkleProof* proof);
+
+// Root implied by a TX hash and its proof; false if the proof is malformed
+bool merkle_proof_root(const uint8_t tx_hash[TX_HASH_SIZE], const MerkleProof* proof,
+                       uint8_t root[MERKLE_HASH_SIZE]);
+
+#endif // MERKLE_H
@@ -0,0 +1,51 @@
+#ifndef SIG_CACHE_H
+#define SIG_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "transaction.h"
+
+// =============================================================================
+// VERIFIED-SIGNATURE CACHE
+// =============================================================================
+//
+// Remembers (tx_hash, BLAKE3(sig_type || sig_len || sig || pubkey)) pairs whose
+// signature has already verified, so the same TX is never verified twice by
+// the same process — e.g. a validator retrying TXs after a missed deadline or
+// a partial block, or the blockchain re-checking a resubmitted block.
+//
+// Only POSITIVE verdicts are stored. The key binds the economic fields (via
+// tx_hash) and the exact signature material, so a hit can only be produced by
+// byte-identical inputs to a verify that already succeeded.
+//
+// Process-wide, sharded (64 shards, one mutex each), direct-mapped, bounded:
+// SIG_CACHE_ENTRIES slots, newest insert wins on a slot conflict.
+// =============================================================================
+
+#define SIG_CACHE_ENTRIES   (1u << 18)   // 262,144 slots, ~16 MB
+
+typedef struct {
+    uint8_t tx_hash[TX_HASH_SIZE];   // transaction_compute_hash()
+    uint8_t sig_digest[32];          // BLAKE3 over sig_type, sig, pubkey
+} SigCacheKey;
+
+// Build the cache key for tx (tx_hash must be transaction_compute_hash(tx))
+void sig_cache_make_key(const Transaction* tx, const uint8_t tx_hash[TX_HASH_SIZE],
+                        SigCacheKey* key);
+
+// Same key from the individual fields (for TXs not held as a Transaction)
+void sig_cache_make_key_raw(uint8_t sig_type,
+                            const uint8_t* sig, size_t sig_len,
+                            const uint8_t* pubkey, size_t pubkey_len,
+                            const uint8_t tx_hash[TX_HASH_SIZE], SigCacheKey* key);
+
+// True if key is known-valid (counts a hit or miss)
+bool sig_cache_contains(const SigCacheKey* key);
+
+// Record key as verified-valid
+void sig_cache_insert(const SigCacheKey* key);
+
+// Lookup counters since process start (any pointer may be NULL)
+void sig_cache_get_stats(uint64_t* hits, uint64_t* misses);
+
+#endif // SIG_CACHE_H
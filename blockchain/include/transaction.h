@@ -8,6 +8,7 @@
 
 // Forward declarations
 typedef struct Wallet Wallet;
+typedef struct TxView TxView;   // Compact arena-backed TX (tx_arena.h)
 
 // =============================================================================
 // TRANSACTION STRUCTURE - variable size depending on SIG_SCHEME
@@ -85,12 +86,22 @@ Transaction* transaction_create_coinbase(const uint8_t farmer_address[20],
 
 // Hash covers only the core economic fields (not sig/pubkey)
 void transaction_compute_hash(const Transaction* tx, uint8_t hash[TX_HASH_SIZE]);
+void tx_view_compute_hash(const TxView* tx, uint8_t hash[TX_HASH_SIZE]);
+
+// Hash count TXs into hashes[i * TX_HASH_SIZE] through blake3_hash_many()
+// (SIMD, 16 per call). NULL entries get an all-zero hash.
+void tx_view_compute_hash_many(const TxView* const* txs, uint32_t count, uint8_t* hashes);
 
 char* transaction_get_hash_hex(const Transaction* tx);
 
 // Verify using tx->sig_type + embedded public key — safe for OpenMP
 bool transaction_verify(const Transaction* tx);
 
+// Verify count TXs via crypto_verify_many(); results[i] = 1 valid / 0 invalid.
+// Verdicts match transaction_verify() per TX. Returns true if all passed.
+bool transaction_verify_batch(Transaction* const* txs, uint32_t count, uint8_t* results);
+bool tx_view_verify_batch(TxView* const* txs, uint32_t count, uint8_t* results);
+
 bool transaction_sign(Transaction* tx, const Wallet* wallet);
 
 bool transaction_is_expired(const Transaction* tx, uint32_t current_block_height);
@@ -4,39 +4,57 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "transaction.h"
+#include "tx_arena.h"
 
 // =============================================================================
-// TRANSACTION POOL - v47 (Simplified: No Hash Table)
+// TRANSACTION POOL
 // =============================================================================
 //
 // DESIGN PHILOSOPHY:
-//   The pool is a SIMPLE, FAST BUFFER. It accepts all TXs without duplicate
-//   checking. The VALIDATOR handles verification (signatures, balances, nonces)
-//   during block creation. This matches the distributed architecture where:
+//   The pool is a SIMPLE, FAST BUFFER. The VALIDATOR handles verification
+//   (signatures, balances, nonces) during block creation. This matches the
+//   distributed architecture where:
 //     - Multiple pools on different nodes receive different TXs
 //     - No single pool can detect all duplicates
 //     - Validators are the authority on TX validity
+//   The pool only rejects exact duplicates (same tx_hash) it already holds.
 //
-// REMOVED (vs v29.4):
-//   - Hash table (8MB, tombstone compaction, O(1) lookup)
-//   - Duplicate detection in pool_add (validator handles via nonce)
-//   - Hash-based confirmation (now uses assigned-index tracking)
-//
-// KEPT:
-//   - Pre-allocated entry array (cache-friendly, no fragmentation)
+// LAYOUT:
+//   - Dense array of 64-byte PoolEntry records: one cache line per TX holding
+//     everything scans, expiry and confirmation need
+//   - Cold bytes (dest/value/fee + signature) in an append-only slab arena;
+//     a slab is recycled once every allocation in it has been released, or
+//     compacted in place when no slab is free and one is at most 1/4 live
+//     (long-lived TXs and pubkeys cannot pin a slab each)
+//   - Public keys deduplicated per sender: one PoolSender record (address +
+//     pubkey in the arena) shared by all of that sender's pooled TXs
 //   - Free list (O(1) slot allocation/deallocation)
-//   - Nonce-ordered sorting for GET_FOR_WINNER
-//   - SortEntry for O(n log n) pubkey reordering
+//   - tx_hash index: open addressing, linear probing, backward-shift delete
+//     (no tombstones). Each 8-byte slot packs entry_idx+1 with a 32-bit hash
+//     tag, so a probe only touches entries[] on a likely match.
+//   - Per-sender pending queue: entries linked in nonce order as they are
+//     added (queue_links[], parallel to entries[])
+//   - Ordered sender index: treap over senders keyed by address, so
+//     GET_FOR_WINNER walks senders in (address, nonce) order without a sort
 //
 // CONFIRMATION FLOW:
-//   1. GET_FOR_WINNER → pool returns K TXs, saves their entry indices
+//   1. GET_FOR_WINNER → pool returns K TXs (they stay PENDING)
 //   2. Blockchain confirms block → sends CONFIRM_BLOCK with TX hashes
-//   3. Pool scans ONLY the assigned indices (not entire array) for matches
-//   4. Confirmed entries freed, unconfirmed returned to PENDING
+//   3. Pool looks each hash up in the index: O(1) per hash
+//   4. Confirmed entries freed, unconfirmed stay PENDING
+//
+// SELECTION MODES (GET_FOR_WINNER):
+//   POOL_SELECT_ADDRESS       senders in address order (default)
+//   POOL_SELECT_FEE_PRIORITY  sender chains by head fee per byte; output is
+//                             still grouped by sender, nonces in order
+//
+// ADMISSION VERIFY (optional, pool --verify-admission):
+//   The pool verifies signatures before pool_add_preverified(); the entry is
+//   flagged and GET_FOR_WINNER reports the flag so a validator run with
+//   --trust-pool-verify can skip its own signature phase for those TXs.
 // =============================================================================
 
 #define MAX_POOL_SIZE       1200000
-#define MAX_ASSIGNED        70000   // Max TXs assigned per block (matches block.h)
 #define MAX_TRACKED_ADDRESSES 1000
 
 typedef enum {
@@ -47,17 +65,61 @@ typedef enum {
     TX_STATUS_REJECTED
 } TxStatus;
 
-typedef struct {
-    Transaction* tx;
-    uint8_t tx_hash[TX_HASH_SIZE];         // Computed once at add time, used for confirmation
-    uint8_t pubkey[CRYPTO_PUBKEY_MAX];     // Signer public key (Ed25519=32B, Falcon=897B, ML-DSA=1312B)
-    size_t  pubkey_len;                    // Actual pubkey bytes stored
-    uint8_t sig_type;                      // SIG_ED25519 / SIG_FALCON512 / SIG_ML_DSA44
-    TxStatus status;
-    uint64_t received_time;
-    uint32_t assigned_block;
+typedef enum {
+    POOL_SELECT_ADDRESS,
+    POOL_SELECT_FEE_PRIORITY
+} PoolSelectMode;
+
+// Arena reference: (slab index << 32) | byte offset within the slab
+typedef uint64_t PoolRef;
+
+typedef struct {                           // 64 bytes — one cache line
+    uint8_t  tx_hash[TX_HASH_SIZE];        // Computed once at add time (index key)
+    uint32_t expiry_block;
+    uint64_t nonce;
+    PoolRef  body;                         // PoolTxBody + sig_len signature bytes
+    uint32_t sender;                       // senders[] index (address + pubkey)
+    uint32_t received_ms;                  // ms since pool->created_ms
+    uint16_t sig_len;
+    uint8_t  sig_type;                     // SIG_ED25519 / SIG_FALCON512 / SIG_ML_DSA44
+    uint8_t  status;                       // TxStatus
+    uint8_t  preverified;                  // 1 = signature verified at admission
+    uint8_t  in_use;                       // 1 = slot holds a pooled TX
+    uint8_t  _pad[2];
 } PoolEntry;
 
+typedef struct {                           // Cold per-TX fields, stored in the arena
+    uint8_t  dest_address[20];
+    uint32_t fee;
+    uint64_t value;
+} PoolTxBody;
+
+typedef struct {
+    uint8_t  address[20];
+    uint16_t pubkey_len;
+    uint32_t refs;                         // pooled TXs using this record (0 = free)
+    PoolRef  pubkey;                       // arena bytes, shared by all refs
+    uint32_t queue_head;                   // lowest-nonce entry idx + 1 (0 = empty)
+    uint32_t queue_tail;                   // highest-nonce entry idx + 1
+    uint32_t order_left;                   // sender index children: id + 1 (0 = none)
+    uint32_t order_right;
+    uint32_t order_prio;                   // treap heap priority (random)
+} PoolSender;
+
+typedef struct {                           // Nonce-queue links, parallel to entries[]
+    uint32_t prev;                         // entry idx + 1 (0 = none)
+    uint32_t next;
+} PoolLink;
+
+#define POOL_SLAB_SIZE      (16u * 1024 * 1024)
+
+typedef struct {
+    uint8_t* data;
+    uint32_t used;                         // bump offset
+    uint32_t live;                         // allocations not yet released
+    uint32_t live_bytes;                   // their size (<= used)
+} PoolSlab;
+
 typedef struct {
     uint8_t address[20];
     uint64_t max_nonce;
@@ -75,11 +137,32 @@ typedef struct {
     uint32_t* free_list;
     uint32_t free_count;
     
-    // Assignment tracking: entry indices of TXs sent to last winning validator
-    // Used for O(K) confirmation instead of hash table lookup
-    uint32_t* assigned_indices;
-    uint32_t assigned_count;
-    uint32_t assigned_block_height;
+    // tx_hash index: slot = (hash_tag << 32) | (entry_idx + 1), 0 = empty
+    uint64_t* hash_index;
+    uint32_t hash_index_mask;     // slots - 1 (power of two, >= 2x capacity)
+    
+    // Senders (pubkey dedup): growable array + free stack + address index
+    PoolSender* senders;
+    uint32_t sender_count;        // high-water mark of senders[]
+    uint32_t sender_capacity;
+    uint32_t* sender_free;
+    uint32_t sender_free_count;
+    uint32_t* sender_index;       // slot = sender_id + 1, 0 = empty
+    uint32_t sender_index_mask;
+    
+    // Pending order: per-sender nonce queues + treap of senders by address
+    PoolLink* queue_links;
+    uint32_t order_root;          // sender id + 1, 0 = no senders
+    uint64_t order_rng;           // xorshift state for order_prio
+    uint8_t select_mode;          // PoolSelectMode for pool_get_pending*
+    
+    // Slab arena for signature / pubkey / body bytes
+    PoolSlab* slabs;
+    uint32_t slab_count;
+    uint32_t slab_capacity;
+    uint32_t cur_slab;
+    
+    uint64_t created_ms;          // base for PoolEntry.received_ms
     
     AddressNonceTracker* nonce_trackers;
     uint32_t nonce_tracker_count;
@@ -91,14 +174,20 @@ TransactionPool* pool_create(void);
 bool pool_add(TransactionPool* pool, Transaction* tx);
 bool pool_add_with_pubkey(TransactionPool* pool, Transaction* tx,
                           const uint8_t* pubkey, size_t pubkey_len, uint8_t sig_type);
+bool pool_add_preverified(TransactionPool* pool, Transaction* tx);
+void pool_set_select_mode(TransactionPool* pool, PoolSelectMode mode);
 uint64_t pool_get_pending_nonce(const TransactionPool* pool, const uint8_t address[20]);
-Transaction** pool_get_pending(TransactionPool* pool, uint32_t max_count, 
-                               uint32_t current_block, uint32_t* out_count);
-Transaction** pool_get_pending_with_pubkeys(TransactionPool* pool, uint32_t max_count,
-                                            uint32_t current_block, uint32_t* out_count,
-                                            uint8_t** pubkeys_out,
-                                            uint64_t** t0_ns_out,
-                                            uint64_t** t1_ns_out);
+// Selected TXs are TxView records allocated in `arena` (the caller resets it
+// between fetches); only the returned pointer array is malloc'd.
+TxView** pool_get_pending(TransactionPool* pool, TxArena* arena, uint32_t max_count,
+                          uint32_t current_block, uint32_t* out_count);
+TxView** pool_get_pending_with_pubkeys(TransactionPool* pool, TxArena* arena,
+                                       uint32_t max_count,
+                                       uint32_t current_block, uint32_t* out_count,
+                                       uint8_t** pubkeys_out,
+                                       uint64_t** t0_ns_out,
+                                       uint64_t** t1_ns_out,
+                                       uint8_t** preverified_out);
 bool pool_confirm(TransactionPool* pool, const uint8_t tx_hash[TX_HASH_SIZE]);
 uint32_t pool_confirm_batch(TransactionPool* pool, const uint8_t* hashes, uint32_t hash_count);
 void pool_return_assigned(TransactionPool* pool, uint32_t block_height);
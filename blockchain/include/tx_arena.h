@@ -0,0 +1,109 @@
+#ifndef TX_ARENA_H
+#define TX_ARENA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "transaction.h"
+
+// =============================================================================
+// COMPACT TRANSACTION VIEWS + ARENA
+// =============================================================================
+//
+// Transaction reserves CRYPTO_SIG_MAX + CRYPTO_PUBKEY_MAX bytes (~3.8 KB) for
+// every TX, even Ed25519 (64 + 32 B). A TxView stores the same TX as one
+// variable-length record inside a TxArena:
+//
+//   [ TxView header (80 B) ][ signature (sig_len) ][ public key (pubkey_len) ]
+//
+// sig_off / pubkey_off are byte offsets from the start of the record, so a
+// view is self-contained and can be cloned between arenas with one memcpy.
+//
+// The header keeps Transaction's field names for the economic fields, so
+// field reads (tx->fee, tx->source_address) and TX_IS_COINBASE() work on
+// either type. transaction_compute_hash() / transaction_verify_batch() have
+// view counterparts declared in transaction.h.
+//
+// TxArena is a bump allocator over a chain of chunks: allocation is a pointer
+// add, records never move, and the whole arena is released at once. Blocks
+// own one arena each; the validator unpacks a pool batch into one arena.
+//
+// Sizes per record: Ed25519 176 B, Falcon-512 ~1.6 KB, ML-DSA-44 ~3.8 KB.
+// =============================================================================
+
+struct TxView {                            // 80 bytes
+    uint64_t nonce;
+    uint32_t expiry_block;
+    uint8_t  source_address[20];
+    uint8_t  dest_address[20];
+    uint32_t fee;
+    uint64_t value;
+    uint16_t sig_off;                      // from record start
+    uint16_t sig_len;
+    uint16_t pubkey_off;                   // from record start
+    uint16_t pubkey_len;
+    uint8_t  sig_type;
+    uint8_t  _pad[7];
+};
+
+typedef struct TxArenaChunk TxArenaChunk;
+
+typedef struct {
+    TxArenaChunk* head;                    // Current chunk (allocations go here)
+    size_t chunk_size;                     // Size of the next chunk to allocate
+    size_t bytes_used;                     // Sum of live record sizes
+    size_t bytes_reserved;                 // Sum of chunk sizes
+} TxArena;
+
+#define TX_ARENA_DEFAULT_CHUNK   (256u * 1024)         // First chunk
+#define TX_ARENA_MAX_CHUNK       (16u * 1024 * 1024)   // Doubling stops here
+
+// =============================================================================
+// ARENA
+// =============================================================================
+
+// Create an arena; initial_bytes = 0 picks TX_ARENA_DEFAULT_CHUNK.
+// No memory is reserved until the first allocation.
+TxArena* tx_arena_create(size_t initial_bytes);
+
+// 8-byte aligned allocation (never fails: safe_malloc semantics)
+void* tx_arena_alloc(TxArena* arena, size_t size);
+
+// Drop every record; keeps the newest chunk for reuse
+void tx_arena_reset(TxArena* arena);
+
+void tx_arena_destroy(TxArena* arena);
+
+// =============================================================================
+// VIEWS
+// =============================================================================
+
+// Allocate a zeroed view with room for sig_len + pubkey_len bytes
+// (offsets and lengths filled in; lengths are clamped to the scheme maxima)
+TxView* tx_view_alloc(TxArena* arena, size_t sig_len, size_t pubkey_len);
+
+// Compact copy of a full Transaction
+TxView* tx_view_create(TxArena* arena, const Transaction* tx);
+
+// Copy a view (possibly from another arena)
+TxView* tx_view_clone(TxArena* arena, const TxView* view);
+
+// Release a view. Space is reclaimed immediately only if it was the most
+// recent allocation; otherwise it returns with tx_arena_reset/destroy.
+void tx_view_free(TxArena* arena, TxView* view);
+
+// Expand into a full Transaction (for legacy fixed-size wire formats)
+void tx_view_to_transaction(const TxView* view, Transaction* out);
+
+// Total record size (header + signature + public key)
+size_t tx_view_size(const TxView* view);
+
+static inline uint8_t* tx_view_signature(const TxView* view) {
+    return (uint8_t*)view + view->sig_off;
+}
+
+static inline uint8_t* tx_view_public_key(const TxView* view) {
+    return (uint8_t*)view + view->pubkey_off;
+}
+
+#endif // TX_ARENA_H
@@ -41,8 +41,9 @@ typedef struct {
     char name[64];
     Wallet* wallet;
     
-    // Plot
-    Plot* plot;
+    // Plots: the wallet's own plot, or every plot in a --plot-dir
+    Plot** plots;
+    uint32_t plot_count;
     uint32_t k_param;
     
     // ZMQ connections
@@ -83,6 +84,8 @@ bool validator_init_sockets(Validator* v,
                             const char* blockchain_addr);
 
 bool validator_generate_plot(Validator* v);
+// Load (map) every *.plot file in dir; each challenge searches all of them
+bool validator_load_plot_dir(Validator* v, const char* dir);
 void validator_handle_challenge(Validator* v, const Challenge* challenge);
 
 // Find proof and submit to metronome (does NOT create block yet)
@@ -94,6 +97,8 @@ bool validator_create_and_submit_block(Validator* v);
 void validator_run(Validator* v);
 void validator_stop(Validator* v);
 void validator_set_max_txs_per_block(uint32_t max_txs);
+// Skip signature verification for TXs the pool flags as pre-verified (TXTV)
+void validator_set_trust_pool_verify(bool enabled);
 void validator_get_stats(const Validator* v, char* buffer, size_t size);
 void validator_destroy(Validator* v);
 
@@ -12,6 +12,9 @@
 #   ./setup_plots.sh                  # k=16, 1 farmer, all 3 schemes
 #   ./setup_plots.sh --k 18 --farmers 4  # k=18, farmers 1-4, all 3 schemes
 #   ./setup_plots.sh --regenerate
+#   ./setup_plots.sh --threads 8         # plot generation threads (default: all cores)
+#   ./setup_plots.sh --compact           # compact plots (12 B/entry instead of 32)
+#   ./setup_plots.sh --k 30 --memory 8192  # stream plots using at most 8 GB of RAM
 set -e
 
 SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
@@ -22,6 +25,9 @@ K_PARAM=16
 NUM_FARMERS=1
 SCHEMES="1 2 4"
 REGEN=0
+THREADS=0
+COMPACT=""
+MEMORY=""
 
 while [ $# -gt 0 ]; do
     case "$1" in
@@ -29,8 +35,11 @@ while [ $# -gt 0 ]; do
         --farmers)     NUM_FARMERS="$2"; shift 2 ;;
         --schemes)     SCHEMES="$2"; shift 2 ;;
         --regenerate)  REGEN=1; shift ;;
+        --threads)     THREADS="$2"; shift 2 ;;
+        --compact)     COMPACT="--compact-plot"; shift ;;
+        --memory)      MEMORY="--plot-memory $2"; shift 2 ;;
         -h|--help)
-            sed -n "2,15p" "$0"; exit 0 ;;
+            sed -n "2,17p" "$0"; exit 0 ;;
         *) echo "Unknown arg: $1"; exit 1 ;;
     esac
 done
@@ -75,7 +84,7 @@ for SCHEME in $SCHEMES; do
         echo "[setup_plots] -- Generating plot for $FARMER (scheme=$NAME, k=$K_PARAM)"
         ./build/wallet create "$FARMER" >/dev/null 2>&1 || true
         # Run validator in --generate-plot-only mode (no sockets, no farming loop)
-        ./build/validator -k $K_PARAM --generate-plot-only "$FARMER" 2>&1 | \
+        ./build/validator -k $K_PARAM --threads $THREADS $COMPACT $MEMORY --generate-plot-only "$FARMER" 2>&1 | \
             grep -E "Plot loaded|Plot saved|Plot ready|generate-plot-only|ERROR" | head -5
     done
 done
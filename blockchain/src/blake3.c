@@ -307,3 +307,204 @@ void blake3_truncated(const uint8_t *input, size_t input_len, uint8_t *output, s
     blake3_hasher_update(&hasher, input, input_len);
     blake3_hasher_finalize(&hasher, output, out_len);
 }
+
+// =============================================================================
+// MULTI-LANE HASHING
+// =============================================================================
+//
+// blake3_hash_many() hashes N same-length messages with one message per
+// 32-bit vector lane: state word i of every message lives in one vector, so
+// each G step runs on 4/8/16 messages at once. Inputs up to one chunk
+// (1024 bytes) take the same compress sequence as blake3_truncated() -
+// chunk blocks (START on the first, END on the last), then the ROOT compress
+// of the chunk CV - so the outputs are bit-identical to it.
+//
+// The kernels are written once with GCC/Clang vector extensions and stamped
+// out per width with a target attribute; the best one the CPU supports is
+// picked on first use. The 4-lane kernel without a target attribute is the
+// portable one (plain SSE2 on x86-64, NEON on arm64).
+
+#define B3_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define B3_G(v, a, b, c, d, mx, my) do {                                \
+    v[a] = v[a] + v[b] + (mx);  v[d] = B3_ROTR(v[d] ^ v[a], 16);        \
+    v[c] = v[c] + v[d];         v[b] = B3_ROTR(v[b] ^ v[c], 12);        \
+    v[a] = v[a] + v[b] + (my);  v[d] = B3_ROTR(v[d] ^ v[a], 8);         \
+    v[c] = v[c] + v[d];         v[b] = B3_ROTR(v[b] ^ v[c], 7);         \
+} while (0)
+
+#define B3_ROUNDS(v, m) do {                                            \
+    for (size_t r = 0; r < 7; r++) {                                    \
+        const uint8_t *s = MSG_SCHEDULE[r];                             \
+        B3_G(v, 0, 4,  8, 12, m[s[0]],  m[s[1]]);                       \
+        B3_G(v, 1, 5,  9, 13, m[s[2]],  m[s[3]]);                       \
+        B3_G(v, 2, 6, 10, 14, m[s[4]],  m[s[5]]);                       \
+        B3_G(v, 3, 7, 11, 15, m[s[6]],  m[s[7]]);                       \
+        B3_G(v, 0, 5, 10, 15, m[s[8]],  m[s[9]]);                       \
+        B3_G(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);                      \
+        B3_G(v, 2, 7,  8, 13, m[s[12]], m[s[13]]);                      \
+        B3_G(v, 3, 4,  9, 14, m[s[14]], m[s[15]]);                      \
+    }                                                                   \
+} while (0)
+
+// Hash exactly LANES messages of input_len <= BLAKE3_CHUNK_LEN bytes into
+// out (out_len <= BLAKE3_OUT_LEN bytes each, contiguous)
+#define B3_DEFINE_HASH_LANES(name, LANES, ATTR)                         \
+typedef uint32_t name##_vec __attribute__((vector_size(4 * (LANES))));  \
+ATTR static void name(const uint8_t *const *inputs, size_t input_len,   \
+                      uint8_t *out, size_t out_len) {                   \
+    const name##_vec zero = {0};                                        \
+    name##_vec cv[8], v[16], m[16];                                     \
+    uint32_t words[16][LANES];                                          \
+    for (int i = 0; i < 8; i++) cv[i] = zero + IV[i];                   \
+    size_t blocks = input_len == 0 ? 1 :                                \
+        (input_len + BLAKE3_BLOCK_LEN - 1) / BLAKE3_BLOCK_LEN;          \
+    for (size_t b = 0; b < blocks; b++) {                               \
+        size_t offset = b * BLAKE3_BLOCK_LEN;                           \
+        size_t len = input_len - offset;                                \
+        if (len > BLAKE3_BLOCK_LEN) len = BLAKE3_BLOCK_LEN;             \
+        uint32_t flags = (b == 0 ? CHUNK_START : 0) |                   \
+                         (b + 1 == blocks ? CHUNK_END : 0);             \
+        for (int l = 0; l < (LANES); l++) {                             \
+            uint8_t block[BLAKE3_BLOCK_LEN] = {0};                      \
+            memcpy(block, inputs[l] + offset, len);                     \
+            for (int i = 0; i < 16; i++)                                \
+                words[i][l] = load32_le(block + i * 4);                 \
+        }                                                               \
+        for (int i = 0; i < 16; i++)                                    \
+            memcpy(&m[i], words[i], sizeof(m[i]));                      \
+        for (int i = 0; i < 8; i++) {                                   \
+            v[i] = cv[i];                                               \
+            v[i + 8] = zero + IV[i];                                    \
+        }                                                               \
+        v[12] = zero;                                                   \
+        v[13] = zero;                                                   \
+        v[14] = zero + (uint32_t)len;                                   \
+        v[15] = zero + flags;                                           \
+        B3_ROUNDS(v, m);                                                \
+        for (int i = 0; i < 8; i++) cv[i] = v[i] ^ v[i + 8];            \
+    }                                                                   \
+    /* ROOT: one block holding the chunk CV, keyed by IV */             \
+    for (int i = 0; i < 8; i++) {                                       \
+        m[i] = cv[i];                                                   \
+        m[i + 8] = zero;                                                \
+        v[i] = zero + IV[i];                                            \
+        v[i + 8] = zero + IV[i];                                        \
+    }                                                                   \
+    v[12] = zero;                                                       \
+    v[13] = zero;                                                       \
+    v[14] = zero + (uint32_t)BLAKE3_OUT_LEN;                            \
+    v[15] = zero + (uint32_t)ROOT;                                      \
+    B3_ROUNDS(v, m);                                                    \
+    for (int i = 0; i < 8; i++) {                                       \
+        cv[i] = v[i] ^ v[i + 8];                                        \
+        memcpy(words[i], &cv[i], sizeof(cv[i]));                        \
+    }                                                                   \
+    for (int l = 0; l < (LANES); l++) {                                 \
+        uint8_t *o = out + (size_t)l * out_len;                         \
+        for (size_t i = 0; i < out_len; i++)                            \
+            o[i] = (uint8_t)(words[i / 4][l] >> (8 * (i % 4)));         \
+    }                                                                   \
+}
+
+B3_DEFINE_HASH_LANES(hash_lanes_portable, 4, )
+
+#if defined(__x86_64__) || defined(__i386__)
+#define B3_HAVE_X86_KERNELS 1
+B3_DEFINE_HASH_LANES(hash_lanes_sse41, 4, __attribute__((target("sse4.1"))))
+B3_DEFINE_HASH_LANES(hash_lanes_avx2, 8, __attribute__((target("avx2"))))
+B3_DEFINE_HASH_LANES(hash_lanes_avx512, 16, __attribute__((target("avx512f"))))
+#endif
+
+typedef void (*hash_lanes_fn)(const uint8_t *const *inputs, size_t input_len,
+                              uint8_t *out, size_t out_len);
+
+typedef struct {
+    const char *name;
+    size_t lanes;
+    hash_lanes_fn fn;
+} simd_kernel;
+
+// Widest first; [count - 1] is the portable kernel
+static const simd_kernel SIMD_KERNELS[] = {
+#ifdef B3_HAVE_X86_KERNELS
+    {"avx512", 16, hash_lanes_avx512},
+    {"avx2",    8, hash_lanes_avx2},
+    {"sse4.1",  4, hash_lanes_sse41},
+#endif
+    {"portable", 4, hash_lanes_portable},
+};
+#define SIMD_KERNEL_COUNT (sizeof(SIMD_KERNELS) / sizeof(SIMD_KERNELS[0]))
+
+static int simd_supported(const simd_kernel *k) {
+#ifdef B3_HAVE_X86_KERNELS
+    if (k->fn == hash_lanes_avx512) return __builtin_cpu_supports("avx512f");
+    if (k->fn == hash_lanes_avx2)   return __builtin_cpu_supports("avx2");
+    if (k->fn == hash_lanes_sse41)  return __builtin_cpu_supports("sse4.1");
+#endif
+    (void)k;
+    return 1;
+}
+
+// Index of the first kernel to use, SIMD_KERNEL_COUNT = scalar only.
+// -1 until the CPU has been probed; the probe is idempotent, so racing
+// threads just store the same value.
+static int simd_selected = -1;
+static size_t simd_max_lanes = 16;
+
+static int simd_select(void) {
+    int selected = __atomic_load_n(&simd_selected, __ATOMIC_ACQUIRE);
+    if (selected >= 0) return selected;
+
+    selected = (int)SIMD_KERNEL_COUNT;
+#ifdef B3_HAVE_X86_KERNELS
+    __builtin_cpu_init();
+#endif
+    for (size_t i = 0; i < SIMD_KERNEL_COUNT; i++) {
+        if (SIMD_KERNELS[i].lanes <= simd_max_lanes && simd_supported(&SIMD_KERNELS[i])) {
+            selected = (int)i;
+            break;
+        }
+    }
+    __atomic_store_n(&simd_selected, selected, __ATOMIC_RELEASE);
+    return selected;
+}
+
+void blake3_set_simd_max_lanes(size_t max_lanes) {
+    simd_max_lanes = max_lanes;
+    __atomic_store_n(&simd_selected, -1, __ATOMIC_RELEASE);
+}
+
+const char *blake3_simd_name(void) {
+    int selected = simd_select();
+    return selected < (int)SIMD_KERNEL_COUNT ? SIMD_KERNELS[selected].name : "scalar";
+}
+
+size_t blake3_simd_lanes(void) {
+    int selected = simd_select();
+    return selected < (int)SIMD_KERNEL_COUNT ? SIMD_KERNELS[selected].lanes : 1;
+}
+
+void blake3_hash_many(const uint8_t *const *inputs, size_t num_inputs, size_t input_len,
+                      uint8_t *out, size_t out_len) {
+    size_t done = 0;
+
+    // Longer inputs need the chunk tree, longer outputs the extension;
+    // both stay on the one-message path
+    if (input_len <= BLAKE3_CHUNK_LEN && out_len <= BLAKE3_OUT_LEN) {
+        int selected = simd_select();
+        // Full-width batches first, then the narrower kernels (a subset of
+        // the selected one's ISA) for the tail
+        for (size_t k = (size_t)selected; k < SIMD_KERNEL_COUNT; k++) {
+            const simd_kernel *kernel = &SIMD_KERNELS[k];
+            while (num_inputs - done >= kernel->lanes) {
+                kernel->fn(inputs + done, input_len, out + done * out_len, out_len);
+                done += kernel->lanes;
+            }
+        }
+    }
+
+    for (; done < num_inputs; done++) {
+        blake3_truncated(inputs[done], input_len, out + done * out_len, out_len);
+    }
+}
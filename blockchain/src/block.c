@@ -12,8 +12,8 @@ Block* block_create(void) {
     Block* block = safe_malloc(sizeof(Block));
     memset(block, 0, sizeof(Block));
     
-    block->transactions = safe_malloc(MAX_TRANSACTIONS_PER_BLOCK * sizeof(Transaction*));
-    memset(block->transactions, 0, MAX_TRANSACTIONS_PER_BLOCK * sizeof(Transaction*));
+    // TX array and arena are created on first add: an empty block is just
+    // the struct
     
     return block;
 }
@@ -38,18 +38,96 @@ Block* block_create_genesis(void) {
 // TRANSACTION MANAGEMENT
 // =============================================================================
 
+static TxArena* block_arena(Block* block) {
+    if (!block->arena) block->arena = tx_arena_create(0);
+    return block->arena;
+}
+
+#define BLOCK_MIN_TX_CAPACITY 16
+
+bool block_reserve(Block* block, uint32_t count) {
+    if (!block || count > MAX_TRANSACTIONS_PER_BLOCK) return false;
+    if (count <= block->tx_capacity) return true;
+    
+    block->transactions = safe_realloc(block->transactions, count * sizeof(TxView*));
+    memset(block->transactions + block->tx_capacity, 0,
+           (count - block->tx_capacity) * sizeof(TxView*));
+    block->tx_capacity = count;
+    return true;
+}
+
+// Room for one more TX: capacity doubles, so n adds cost O(n) copies
+static bool block_grow(Block* block) {
+    uint32_t count = block->header.transaction_count;
+    if (count < block->tx_capacity) return true;
+    if (count >= MAX_TRANSACTIONS_PER_BLOCK) return false;
+    
+    uint32_t capacity = block->tx_capacity ? block->tx_capacity * 2 : BLOCK_MIN_TX_CAPACITY;
+    if (capacity > MAX_TRANSACTIONS_PER_BLOCK) capacity = MAX_TRANSACTIONS_PER_BLOCK;
+    return block_reserve(block, capacity);
+}
+
 bool block_add_transaction(Block* block, Transaction* tx) {
     if (!block || !tx) return false;
-    if (block->header.transaction_count >= MAX_TRANSACTIONS_PER_BLOCK) return false;
+    if (!block_grow(block)) return false;
     
-    Transaction* tx_copy = safe_malloc(sizeof(Transaction));
-    memcpy(tx_copy, tx, sizeof(Transaction));
+    TxView* tx_copy = tx_view_create(block_arena(block), tx);
     
     block->transactions[block->header.transaction_count++] = tx_copy;
     
     return true;
 }
 
+bool block_add_tx_view(Block* block, const TxView* tx) {
+    if (!block || !tx) return false;
+    if (!block_grow(block)) return false;
+    
+    block->transactions[block->header.transaction_count++] =
+        tx_view_clone(block_arena(block), tx);
+    
+    return true;
+}
+
+void block_compact(Block* block) {
+    if (!block) return;
+    
+    // ~64 B per TX of tree; proofs for sealed blocks rebuild it
+    merkle_destroy(block->merkle);
+    block->merkle = NULL;
+    if (block->tx_capacity == block->header.transaction_count) return;
+    
+    // Empty slots stay: they are part of the block hash (zero TX hash)
+    uint32_t count = block->header.transaction_count;
+    if (count == 0) {
+        free(block->transactions);
+        block->transactions = NULL;
+    } else {
+        block->transactions = safe_realloc(block->transactions, count * sizeof(TxView*));
+    }
+    block->tx_capacity = count;
+}
+
+Block* block_copy(const Block* block) {
+    if (!block) return NULL;
+    
+    // Slot for slot: empty slots are part of the block hash (zero TX hash)
+    uint32_t count = block->header.transaction_count;
+    Block* copy = block_create();
+    memcpy(&copy->header, &block->header, sizeof(BlockHeader));
+    copy->total_fees = block->total_fees;
+    if (count > 0) {
+        copy->transactions = safe_malloc(count * sizeof(TxView*));
+        copy->tx_capacity = count;
+        TxArena* arena = block_arena(copy);
+        for (uint32_t i = 0; i < count; i++) {
+            copy->transactions[i] = block->transactions[i]
+                ? tx_view_clone(arena, block->transactions[i]) : NULL;
+        }
+    }
+    
+    return copy;
+}
+
 uint64_t block_calculate_fees(const Block* block) {
     if (!block) return 0;
     
@@ -83,68 +161,134 @@ void block_set_proof(Block* block, const SpaceProof* proof,
 // HASH CALCULATION
 // =============================================================================
 
+// Leaf hashes for TXs [from, to) of the block's tree (NULL slot = zero TX hash)
+static void merkle_fill_leaves(const Block* block, MerkleTree* tree, uint32_t from, uint32_t to) {
+    // 16 TXs per step: one SIMD pass for the TX hashes, one for the leaves
+    uint32_t batches = (to - from + 15) / 16;
+    #pragma omp parallel for schedule(static) if (to - from >= MERKLE_PARALLEL_MIN)
+    for (uint32_t b = 0; b < batches; b++) {
+        uint32_t first = from + b * 16;
+        uint32_t n = to - first < 16 ? to - first : 16;
+        uint8_t tx_hashes[16 * TX_HASH_SIZE];
+        tx_view_compute_hash_many((const TxView* const*)block->transactions + first, n, tx_hashes);
+        merkle_leaf_hash_many(tx_hashes, n, merkle_leaf(tree, first));
+    }
+}
+
+// Fresh, unhashed tree over all of the block's TXs (caller destroys)
+static MerkleTree* merkle_build(const Block* block) {
+    uint32_t count = block->header.transaction_count;
+    MerkleTree* tree = merkle_create();
+    merkle_resize(tree, count);
+    merkle_fill_leaves(block, tree, 0, count);
+    return tree;
+}
+
+// The cached tree, if it is current for the block's TX count
+static const MerkleTree* merkle_current(const Block* block) {
+    const MerkleTree* tree = block->merkle;
+    if (!tree || tree->leaf_count != block->header.transaction_count) return NULL;
+    return tree->dirty_from >= tree->leaf_count ? tree : NULL;
+}
+
+void block_tx_root(const Block* block, uint8_t root[32]) {
+    uint32_t count = block ? block->header.transaction_count : 0;
+    if (count == 0) {
+        memset(root, 0, 32);
+        return;
+    }
+    
+    const MerkleTree* cached = merkle_current(block);
+    if (cached && merkle_cached_root(cached, root)) return;
+    
+    MerkleTree* tree = merkle_build(block);
+    merkle_root(tree, root);
+    merkle_destroy(tree);
+}
+
+void block_tx_changed(Block* block, uint32_t index) {
+    if (!block || !block->merkle || index >= block->merkle->leaf_count) return;
+    merkle_fill_leaves(block, block->merkle, index, index + 1);
+    merkle_leaf_changed(block->merkle, index);
+}
+
+// SHA256(header fields || tx_root), fixed 200-byte input
+static void block_header_digest(const BlockHeader* header, const uint8_t tx_root[32],
+                                uint8_t out[32]) {
+    uint8_t buffer[256];
+    size_t offset = 0;
+    
+    memcpy(buffer + offset, header->previous_hash, 32); offset += 32;
+    memcpy(buffer + offset, &header->height, 4); offset += 4;
+    memcpy(buffer + offset, &header->timestamp, 8); offset += 8;
+    memcpy(buffer + offset, header->farmer_address, 20); offset += 20;
+    memcpy(buffer + offset, &header->difficulty, 4); offset += 4;
+    memcpy(buffer + offset, header->challenge_hash, 32); offset += 32;
+    memcpy(buffer + offset, header->proof_hash, 28); offset += 28;
+    memcpy(buffer + offset, &header->proof_nonce, 4); offset += 4;
+    memcpy(buffer + offset, header->quality, 32); offset += 32;
+    memcpy(buffer + offset, &header->transaction_count, 4); offset += 4;
+    memcpy(buffer + offset, tx_root, 32); offset += 32;  // Covers ALL TXs
+    
+    sha256(buffer, offset, out);
+}
+
 void block_calculate_hash(Block* block) {
     if (!block) return;
     
     // =========================================================================
-    // BLOCK HASH = SHA256(header_fields || tx_commitment)
-    //
-    // tx_commitment = BLAKE3(tx_hash_0 || tx_hash_1 || ... || tx_hash_N)
+    // BLOCK HASH = SHA256(header_fields || tx_root)
     //
-    // WHY: The old approach put individual TX hashes into a 512-byte buffer,
-    //   silently dropping all TXs beyond ~12 (the buffer could only hold 
-    //   168 bytes of header + 12 × 28 bytes of TX hashes = 504 bytes).
-    //   For a 10,000 TX block, 99.88% of TXs were EXCLUDED from the block hash.
+    // tx_root = Merkle root over the TX hashes (see merkle.h)
     //
-    // This approach computes a single 32-byte commitment over ALL TX hashes,
-    // similar to Bitcoin's Merkle root but using a flat hash (sufficient for
-    // single-node verification). For the distributed version, this should be
-    // upgraded to a proper Merkle tree for SPV (Simplified Payment Verification)
-    // support, allowing light clients to verify individual TX inclusion without
-    // downloading the full block.
+    // The header commits to ALL TXs through one 32-byte root. Unlike the
+    // earlier flat BLAKE3(tx_hash_0 || ... || tx_hash_N), a single TX can be
+    // shown to be in the block with log2(N) sibling hashes (block_tx_proof),
+    // so light clients verify inclusion without downloading the block. While
+    // a block is being built the tree is cached on it: TXs appended since
+    // the last hash cost one leaf each plus their path. block_compact()
+    // drops the tree once the block is sealed.
     // =========================================================================
     
-    // Step 1: Compute TX commitment hash (covers ALL transactions)
-    uint8_t tx_commitment[32];
-    memset(tx_commitment, 0, 32);
-    
-    if (block->header.transaction_count > 0 && block->transactions) {
-        // Allocate buffer for all TX hashes
-        size_t tx_hashes_size = (size_t)block->header.transaction_count * TX_HASH_SIZE;
-        uint8_t* tx_hashes_buf = safe_malloc(tx_hashes_size);
-        
-        for (uint32_t i = 0; i < block->header.transaction_count; i++) {
-            if (block->transactions[i]) {
-                transaction_compute_hash(block->transactions[i], 
-                                         tx_hashes_buf + i * TX_HASH_SIZE);
-            } else {
-                memset(tx_hashes_buf + i * TX_HASH_SIZE, 0, TX_HASH_SIZE);
-            }
-        }
-        
-        // BLAKE3 hash of all TX hashes → single 32-byte commitment
-        blake3_hash(tx_hashes_buf, tx_hashes_size, tx_commitment);
-        free(tx_hashes_buf);
+    uint8_t tx_root[32];
+    uint32_t count = block->header.transaction_count;
+    if (count == 0) {
+        memset(tx_root, 0, 32);
+    } else {
+        // Extend the block's own tree: only leaves added since the last call
+        if (!block->merkle) block->merkle = merkle_create();
+        uint32_t hashed = block->merkle->leaf_count;
+        merkle_resize(block->merkle, count);
+        if (count > hashed) merkle_fill_leaves(block, block->merkle, hashed, count);
+        merkle_root(block->merkle, tx_root);
     }
-    
-    // Step 2: Hash header fields + tx_commitment
-    // Header: 168 bytes + tx_commitment: 32 bytes = 200 bytes total (fixed size!)
-    uint8_t buffer[256];  // More than enough for fixed-size header + commitment
-    size_t offset = 0;
-    
-    memcpy(buffer + offset, block->header.previous_hash, 32); offset += 32;
-    memcpy(buffer + offset, &block->header.height, 4); offset += 4;
-    memcpy(buffer + offset, &block->header.timestamp, 8); offset += 8;
-    memcpy(buffer + offset, block->header.farmer_address, 20); offset += 20;
-    memcpy(buffer + offset, &block->header.difficulty, 4); offset += 4;
-    memcpy(buffer + offset, block->header.challenge_hash, 32); offset += 32;
-    memcpy(buffer + offset, block->header.proof_hash, 28); offset += 28;
-    memcpy(buffer + offset, &block->header.proof_nonce, 4); offset += 4;
-    memcpy(buffer + offset, block->header.quality, 32); offset += 32;
-    memcpy(buffer + offset, &block->header.transaction_count, 4); offset += 4;
-    memcpy(buffer + offset, tx_commitment, 32); offset += 32;  // Covers ALL TXs
-    
-    sha256(buffer, offset, block->header.hash);
+    block_header_digest(&block->header, tx_root, block->header.hash);
+}
+
+bool block_tx_proof(const Block* block, uint32_t index, MerkleProof* proof) {
+    if (!block || !proof || index >= block->header.transaction_count) return false;
+    
+    const MerkleTree* cached = merkle_current(block);
+    if (cached) return merkle_proof(cached, index, proof);
+    
+    // Sealed blocks keep no tree: rebuild it for the proof
+    uint8_t root[32];
+    MerkleTree* tree = merkle_build(block);
+    merkle_root(tree, root);
+    bool ok = merkle_proof(tree, index, proof);
+    merkle_destroy(tree);
+    return ok;
+}
+
+bool block_verify_tx_proof(const BlockHeader* header, const uint8_t tx_hash[TX_HASH_SIZE],
+                           const MerkleProof* proof) {
+    if (!header || !tx_hash || !proof) return false;
+    if (proof->leaf_count != header->transaction_count) return false;
+    
+    uint8_t root[32], digest[32];
+    if (!merkle_proof_root(tx_hash, proof, root)) return false;
+    block_header_digest(header, root, digest);
+    return memcmp(digest, header->hash, 32) == 0;
 }
 
 // =============================================================================
@@ -180,22 +324,25 @@ bool block_verify(const Block* block, const Block* prev_block) {
         }
     }
     
-    // Verify block hash - create temp with proper initialization
-    Block temp;
-    memset(&temp, 0, sizeof(Block));
-    memcpy(&temp.header, &block->header, sizeof(BlockHeader));
-    temp.transactions = block->transactions;
-    
-    // Save original hash before recalculating
-    uint8_t original_hash[32];
-    memcpy(original_hash, block->header.hash, 32);
+    // Every TX the header counts must be present: an empty slot hashes as a
+    // zero leaf, but could not be applied, stored or served
+    for (uint32_t i = 0; i < block->header.transaction_count; i++) {
+        if (!block->transactions[i]) {
+            LOG_ERROR("Block #%u verification failed: TX %u of %u missing",
+                      block->header.height, i, block->header.transaction_count);
+            return false;
+        }
+    }
     
-    block_calculate_hash(&temp);
+    // Verify block hash (the TX tree is reused if this block still has it)
+    uint8_t tx_root[32], digest[32];
+    block_tx_root(block, tx_root);
+    block_header_digest(&block->header, tx_root, digest);
     
-    if (memcmp(temp.header.hash, original_hash, 32) != 0) {
+    if (memcmp(digest, block->header.hash, 32) != 0) {
         char exp_hex[65], got_hex[65];
-        bytes_to_hex_buf(original_hash, 32, exp_hex);
-        bytes_to_hex_buf(temp.header.hash, 32, got_hex);
+        bytes_to_hex_buf(block->header.hash, 32, exp_hex);
+        bytes_to_hex_buf(digest, 32, got_hex);
         LOG_ERROR("Block #%u verification failed: hash mismatch", block->header.height);
         LOG_ERROR("   Original:     %.32s...", exp_hex);
         LOG_ERROR("   Recalculated: %.32s...", got_hex);
@@ -215,6 +362,14 @@ bool block_has_valid_proof(const Block* block) {
 // PROTOBUF SERIALIZATION
 // =============================================================================
 
+// Off: legacy wire format (64-byte signature prefix, no public key).
+// On: full signature + public key + sig_type so the receiver can re-verify.
+static bool pb_full_signatures = false;
+
+void block_set_pb_full_signatures(bool enabled) {
+    pb_full_signatures = enabled;
+}
+
 uint8_t* block_serialize_pb(const Block* block, size_t* out_len) {
     if (!block) return NULL;
     
@@ -254,7 +409,8 @@ uint8_t* block_serialize_pb(const Block* block, size_t* out_len) {
     
     // Serialize transactions using ZERO-COPY pointers
     // OLD: 30K small mallocs (20B addr × 2 + 48B sig) × 10K TXs = ~50ms overhead
-    // NEW: point directly into Transaction struct memory = ~2ms
+    // NEW: point directly into the block's TxView records = ~2ms
+    // Empty slots (a block still being filled) are skipped, as in block_serialize
     uint32_t tc = block->header.transaction_count;
     Blockchain__Transaction** pb_txs = NULL;
     Blockchain__Transaction* pb_tx_array = NULL;  // single contiguous allocation
@@ -262,19 +418,18 @@ uint8_t* block_serialize_pb(const Block* block, size_t* out_len) {
     if (tc > 0) {
         pb_txs = safe_malloc(tc * sizeof(Blockchain__Transaction*));
         pb_tx_array = safe_malloc(tc * sizeof(Blockchain__Transaction));
-        pb_block.n_transactions = tc;
         pb_block.transactions = pb_txs;
         
         for (uint32_t i = 0; i < tc; i++) {
-            Transaction* tx = block->transactions[i];
-            Blockchain__Transaction* pb_tx = &pb_tx_array[i];
+            TxView* tx = block->transactions[i];
+            if (!tx) continue;
+            Blockchain__Transaction* pb_tx = &pb_tx_array[pb_block.n_transactions];
             blockchain__transaction__init(pb_tx);
             
             pb_tx->nonce = tx->nonce;
             pb_tx->expiry_block = tx->expiry_block;
             
-            // Zero-copy: point directly into packed Transaction struct
-            // Transaction is #pragma pack(push, 1) so fields are contiguous
+            // Zero-copy: point directly into the TxView record
             pb_tx->source_address.len = 20;
             pb_tx->source_address.data = tx->source_address;
             
@@ -285,12 +440,19 @@ uint8_t* block_serialize_pb(const Block* block, size_t* out_len) {
             pb_tx->fee = tx->fee;
             
             // Only set signature if non-zero (coinbase has zero sig)
-            if (!is_zero(tx->signature, 64)) {
-                pb_tx->signature.len = 64;
-                pb_tx->signature.data = tx->signature;
+            size_t prefix = tx->sig_len < 64 ? tx->sig_len : 64;
+            if (prefix > 0 && !is_zero(tx_view_signature(tx), prefix)) {
+                pb_tx->signature.len = prefix;
+                pb_tx->signature.data = tx_view_signature(tx);
+                if (pb_full_signatures && tx->pubkey_len > 0) {
+                    pb_tx->signature.len = tx->sig_len;
+                    pb_tx->public_key.len = tx->pubkey_len;
+                    pb_tx->public_key.data = tx_view_public_key(tx);
+                    pb_tx->sig_type = tx->sig_type;
+                }
             }
             
-            pb_txs[i] = pb_tx;
+            pb_txs[pb_block.n_transactions++] = pb_tx;
         }
     }
     
@@ -343,14 +505,38 @@ Block* block_deserialize_pb(const uint8_t* data, size_t len) {
         block->header.transaction_count = h->transaction_count;
     }
     
+    // The header count is hashed as sent; slots without a TX stay NULL
+    uint32_t slots = block->header.transaction_count;
+    if (pb_block->n_transactions > slots) slots = (uint32_t)pb_block->n_transactions;
+    if (!block_reserve(block, slots)) {
+        LOG_WARN("Block #%u: %u transactions exceeds the per-block limit",
+                 block->header.height, slots);
+        blockchain__block__free_unpacked(pb_block, NULL);
+        block_destroy(block);
+        return NULL;
+    }
+    
     block->total_fees = pb_block->total_fees;
     
-    // Deserialize transactions
-    for (size_t i = 0; i < pb_block->n_transactions && i < MAX_TRANSACTIONS_PER_BLOCK; i++) {
+    // Deserialize transactions: one arena for the whole block, each record
+    // sized to the signature material actually on the wire
+    if (pb_block->n_transactions > 0)
+        block->arena = tx_arena_create(len);
+    for (size_t i = 0; i < pb_block->n_transactions; i++) {
         Blockchain__Transaction* pb_tx = pb_block->transactions[i];
         
-        Transaction* tx = safe_malloc(sizeof(Transaction));
-        memset(tx, 0, sizeof(Transaction));
+        // Full signature material (block_set_pb_full_signatures on the sender);
+        // otherwise keep the legacy 64-byte prefix with no public key
+        bool full = pb_tx->public_key.data && pb_tx->public_key.len > 0 &&
+                    pb_tx->public_key.len <= CRYPTO_PUBKEY_MAX &&
+                    pb_tx->signature.len <= CRYPTO_SIG_MAX;
+        size_t sig_len = 0;
+        if (pb_tx->signature.data && pb_tx->signature.len > 0)
+            sig_len = full ? pb_tx->signature.len
+                           : (pb_tx->signature.len < 64 ? pb_tx->signature.len : 64);
+        
+        TxView* tx = tx_view_alloc(block->arena, sig_len,
+                                   full ? pb_tx->public_key.len : 0);
         
         tx->nonce = pb_tx->nonce;
         tx->expiry_block = pb_tx->expiry_block;
@@ -363,9 +549,11 @@ Block* block_deserialize_pb(const uint8_t* data, size_t len) {
         tx->value = pb_tx->value;
         tx->fee = pb_tx->fee;
         
-        if (pb_tx->signature.data && pb_tx->signature.len > 0) {
-            size_t sig_len = pb_tx->signature.len < 64 ? pb_tx->signature.len : 64;
-            memcpy(tx->signature, pb_tx->signature.data, sig_len);
+        if (sig_len > 0)
+            memcpy(tx_view_signature(tx), pb_tx->signature.data, sig_len);
+        if (full) {
+            memcpy(tx_view_public_key(tx), pb_tx->public_key.data, pb_tx->public_key.len);
+            tx->sig_type = (uint8_t)pb_tx->sig_type;
         }
         
         block->transactions[i] = tx;
@@ -397,14 +585,17 @@ char* block_serialize(const Block* block) {
     
     ptr += sprintf(ptr, "%u:", block->header.transaction_count);
     
-    // Serialize transactions
+    // Serialize transactions (wire format is the full fixed-size Transaction)
+    Transaction* tmp = safe_malloc(sizeof(Transaction));
     for (uint32_t i = 0; i < block->header.transaction_count; i++) {
         if (block->transactions[i]) {
-            bytes_to_hex_buf((uint8_t*)block->transactions[i], TX_TOTAL_SIZE, ptr);
+            tx_view_to_transaction(block->transactions[i], tmp);
+            bytes_to_hex_buf((uint8_t*)tmp, TX_TOTAL_SIZE, ptr);
             ptr += TX_TOTAL_SIZE * 2;
             *ptr++ = '|';
         }
     }
+    free(tmp);
     
     *ptr = '\0';
     return result;
@@ -435,17 +626,27 @@ Block* block_deserialize(const char* hex_data) {
     while (*ptr && *ptr != ':') ptr++;
     if (*ptr == ':') ptr++;
     
+    uint32_t slots = block->header.transaction_count > tx_count
+                   ? block->header.transaction_count : tx_count;
+    if (!block_reserve(block, slots)) {
+        block_destroy(block);
+        return NULL;
+    }
+    
     // Deserialize transactions
+    Transaction* tmp = safe_malloc(sizeof(Transaction));
     for (uint32_t i = 0; i < tx_count && *ptr; i++) {
         if (strlen(ptr) < TX_TOTAL_SIZE * 2) break;
         
-        Transaction* tx = safe_malloc(sizeof(Transaction));
-        hex_to_bytes_buf(ptr, (uint8_t*)tx, TX_TOTAL_SIZE);
-        block->transactions[i] = tx;
+        hex_to_bytes_buf(ptr, (uint8_t*)tmp, TX_TOTAL_SIZE);
+        if (tmp->sig_len > CRYPTO_SIG_MAX) tmp->sig_len = CRYPTO_SIG_MAX;
+        if (tmp->pubkey_len > CRYPTO_PUBKEY_MAX) tmp->pubkey_len = CRYPTO_PUBKEY_MAX;
+        block->transactions[i] = tx_view_create(block_arena(block), tmp);
         
         ptr += TX_TOTAL_SIZE * 2;
         if (*ptr == '|') ptr++;
     }
+    free(tmp);
     
     return block;
 }
@@ -454,7 +655,7 @@ Block* block_deserialize(const char* hex_data) {
 // UTILITIES
 // =============================================================================
 
-Transaction* block_get_coinbase(const Block* block) {
+TxView* block_get_coinbase(const Block* block) {
     if (!block || block->header.transaction_count == 0) return NULL;
     return block->transactions[0];
 }
@@ -487,14 +688,10 @@ void block_print(const Block* block) {
 void block_destroy(Block* block) {
     if (!block) return;
     
-    if (block->transactions) {
-        for (uint32_t i = 0; i < block->header.transaction_count; i++) {
-            if (block->transactions[i]) {
-                free(block->transactions[i]);
-            }
-        }
-        free(block->transactions);
-    }
+    // TX records live in the arena: one release for the whole block
+    if (block->transactions) free(block->transactions);
+    tx_arena_destroy(block->arena);
+    merkle_destroy(block->merkle);
     
     free(block);
 }
@@ -0,0 +1,369 @@
+#include "../include/block_store.h"
+#include "../include/common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define RECORD_MAGIC   "QBLK"
+#define RECORD_HEADER  16                  // magic + length + height
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+static void segment_path(const BlockStore* store, uint32_t segment, char* out, size_t size) {
+    snprintf(out, size, "%s/seg_%06u.dat", store->dir, segment);
+}
+
+static bool write_full(int fd, const uint8_t* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static void index_push(BlockStore* store, uint32_t segment, uint32_t offset, uint32_t length) {
+    if (store->count == store->capacity) {
+        store->capacity = store->capacity ? store->capacity * 2 : 1024;
+        store->index = safe_realloc(store->index, store->capacity * sizeof(BlockStoreIndex));
+    }
+    BlockStoreIndex* ix = &store->index[store->count++];
+    ix->segment = segment;
+    ix->offset = offset;
+    ix->length = length;
+}
+
+static void unmap_segments_from(BlockStore* store, uint32_t first_segment) {
+    for (int i = 0; i < BLOCK_STORE_MAX_MAPPED; i++) {
+        BlockStoreMap* m = &store->maps[i];
+        if (m->base && m->segment >= first_segment) {
+            munmap(m->base, m->length);
+            m->base = NULL;
+        }
+    }
+}
+
+static void cold_drop_from(BlockStore* store, uint64_t height) {
+    for (int i = 0; i < BLOCK_STORE_COLD_CACHE; i++) {
+        if (store->cold[i] && store->cold_height[i] >= height) {
+            block_destroy(store->cold[i]);
+            store->cold[i] = NULL;
+        }
+    }
+}
+
+// Make a newly created file's directory entry durable
+static void sync_dir(const char* dir) {
+    int fd = open(dir, O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return;
+    fsync(fd);
+    close(fd);
+}
+
+static bool open_segment(BlockStore* store, uint32_t segment) {
+    char path[512];
+    segment_path(store, segment, path, sizeof(path));
+    bool existed = access(path, F_OK) == 0;
+    int fd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0) {
+        LOG_ERROR("block store: cannot open %s: %s", path, strerror(errno));
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    store->fd = fd;
+    store->segment = segment;
+    store->segment_bytes = (uint64_t)st.st_size;
+    if (!existed) sync_dir(store->dir);
+    return true;
+}
+
+// Index every record of one segment. Returns false if the scan stopped
+// before the end of the file; *good_end is the end of the last valid record.
+static bool scan_segment(BlockStore* store, uint32_t segment, int fd, uint64_t size,
+                         uint64_t* good_end) {
+    uint64_t pos = 0;
+    while (pos < size) {
+        uint8_t hdr[RECORD_HEADER];
+        uint32_t length;
+        uint64_t height;
+        if (size - pos < RECORD_HEADER ||
+            pread(fd, hdr, RECORD_HEADER, (off_t)pos) != RECORD_HEADER) break;
+        memcpy(&length, hdr + 4, 4);
+        memcpy(&height, hdr + 8, 8);
+        if (memcmp(hdr, RECORD_MAGIC, 4) != 0 || height != store->count ||
+            size - pos - RECORD_HEADER < length) break;
+
+        index_push(store, segment, (uint32_t)(pos + RECORD_HEADER), length);
+        pos += RECORD_HEADER + length;
+    }
+    *good_end = pos;
+    return pos == size;
+}
+
+// =============================================================================
+// OPEN / CLOSE
+// =============================================================================
+
+BlockStore* block_store_open(const char* dir) {
+    if (!dir) return NULL;
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+        LOG_ERROR("block store: cannot create %s: %s", dir, strerror(errno));
+        return NULL;
+    }
+
+    BlockStore* store = safe_malloc(sizeof(BlockStore));
+    memset(store, 0, sizeof(BlockStore));
+    size_t dir_len = strlen(dir) + 1;
+    store->dir = safe_malloc(dir_len);
+    memcpy(store->dir, dir, dir_len);
+    store->fd = -1;
+
+    uint32_t last = 0;
+    for (uint32_t segment = 0;; segment++) {
+        char path[512];
+        segment_path(store, segment, path, sizeof(path));
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) break;
+
+        struct stat st;
+        uint64_t good_end = 0;
+        bool clean = fstat(fd, &st) == 0 &&
+                     scan_segment(store, segment, fd, (uint64_t)st.st_size, &good_end);
+        close(fd);
+        last = segment;
+        if (!clean) {
+            // A torn tail means the crash happened here: nothing after it
+            // was acknowledged, so later segments are discarded too.
+            LOG_WARN("block store: %s damaged at offset %lu, truncating", path, good_end);
+            if (truncate(path, (off_t)good_end) != 0)
+                LOG_WARN("block store: truncate %s failed: %s", path, strerror(errno));
+            for (uint32_t later = segment + 1;; later++) {
+                segment_path(store, later, path, sizeof(path));
+                if (unlink(path) != 0) break;
+            }
+            break;
+        }
+    }
+
+    if (!open_segment(store, last)) {
+        block_store_close(store);
+        return NULL;
+    }
+    store->synced_count = store->count;
+
+    LOG_INFO("📦 Block store %s: %lu blocks in %u segment(s)",
+             dir, store->count, store->segment + 1);
+    return store;
+}
+
+void block_store_close(BlockStore* store) {
+    if (!store) return;
+    if (store->fd >= 0) close(store->fd);
+    unmap_segments_from(store, 0);
+    cold_drop_from(store, 0);
+    free(store->index);
+    free(store->dir);
+    free(store);
+}
+
+// =============================================================================
+// APPEND
+// =============================================================================
+
+bool block_store_append_raw(BlockStore* store, uint64_t height,
+                            const uint8_t* data, size_t len) {
+    if (!store || !data || store->fd < 0) return false;
+    if (height != store->count) {
+        LOG_ERROR("block store: append at height %lu, expected %lu", height, store->count);
+        return false;
+    }
+    if (len > UINT32_MAX - RECORD_HEADER) return false;
+
+    uint64_t record = RECORD_HEADER + len;
+    if (store->segment_bytes > 0 &&
+        store->segment_bytes + record > BLOCK_STORE_SEGMENT_BYTES) {
+        if (fdatasync(store->fd) != 0)
+            LOG_WARN("block store: fdatasync segment %u failed: %s",
+                     store->segment, strerror(errno));
+        close(store->fd);
+        store->fd = -1;
+        if (!open_segment(store, store->segment + 1)) return false;
+    }
+
+    uint8_t hdr[RECORD_HEADER];
+    uint32_t length = (uint32_t)len;
+    memcpy(hdr, RECORD_MAGIC, 4);
+    memcpy(hdr + 4, &length, 4);
+    memcpy(hdr + 8, &height, 8);
+    if (!write_full(store->fd, hdr, RECORD_HEADER) || !write_full(store->fd, data, len)) {
+        LOG_ERROR("block store: write failed for block %lu: %s", height, strerror(errno));
+        if (ftruncate(store->fd, (off_t)store->segment_bytes) != 0)
+            LOG_WARN("block store: could not roll back partial record");
+        return false;
+    }
+
+    index_push(store, store->segment, (uint32_t)(store->segment_bytes + RECORD_HEADER), length);
+    store->segment_bytes += record;
+    store->bytes_written += record;
+    return true;
+}
+
+bool block_store_append(BlockStore* store, const Block* block) {
+    if (!store || !block) return false;
+
+    size_t len = 0;
+    uint8_t* data = block_serialize_pb(block, &len);
+    if (!data) return false;
+    bool ok = block_store_append_raw(store, block->header.height, data, len);
+    free(data);
+    return ok;
+}
+
+uint64_t block_store_height(const BlockStore* store) {
+    return store ? store->count : 0;
+}
+
+bool block_store_sync(BlockStore* store) {
+    if (!store || store->fd < 0) return false;
+    if (store->synced_count == store->count) return true;
+    if (fdatasync(store->fd) != 0) {
+        LOG_ERROR("block store: fdatasync failed: %s", strerror(errno));
+        return false;
+    }
+    store->synced_count = store->count;
+    return true;
+}
+
+// =============================================================================
+// READ
+// =============================================================================
+
+const uint8_t* block_store_get_raw(BlockStore* store, uint64_t height, size_t* len) {
+    if (!store || height >= store->count) return NULL;
+
+    const BlockStoreIndex* ix = &store->index[height];
+    size_t need = (size_t)ix->offset + ix->length;
+
+    // Reuse a mapping of the segment if it is long enough; a mapping of the
+    // append segment made before this block was written is replaced.
+    BlockStoreMap* map = NULL;
+    BlockStoreMap* victim = NULL;
+    for (int i = 0; i < BLOCK_STORE_MAX_MAPPED; i++) {
+        BlockStoreMap* m = &store->maps[i];
+        if (m->base && m->segment == ix->segment) {
+            if (m->length >= need) map = m;
+            else victim = m;
+            break;
+        }
+    }
+    if (!map && !victim) {
+        for (int i = 0; i < BLOCK_STORE_MAX_MAPPED; i++) {
+            BlockStoreMap* m = &store->maps[i];
+            if (!m->base) { victim = m; break; }
+            if (!victim || m->last_use < victim->last_use) victim = m;
+        }
+    }
+
+    if (!map) {
+        if (victim->base) {
+            munmap(victim->base, victim->length);
+            victim->base = NULL;
+        }
+
+        char path[512];
+        segment_path(store, ix->segment, path, sizeof(path));
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) return NULL;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < need) {
+            close(fd);
+            return NULL;
+        }
+        void* base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) {
+            LOG_ERROR("block store: mmap %s failed: %s", path, strerror(errno));
+            return NULL;
+        }
+        madvise(base, (size_t)st.st_size, MADV_RANDOM);
+
+        map = victim;
+        map->base = base;
+        map->length = (size_t)st.st_size;
+        map->segment = ix->segment;
+    }
+
+    map->last_use = ++store->map_clock;
+    if (len) *len = ix->length;
+    return map->base + ix->offset;
+}
+
+Block* block_store_get(BlockStore* store, uint64_t height) {
+    if (!store || height >= store->count) return NULL;
+
+    for (int i = 0; i < BLOCK_STORE_COLD_CACHE; i++) {
+        if (store->cold[i] && store->cold_height[i] == height) return store->cold[i];
+    }
+
+    size_t len = 0;
+    const uint8_t* data = block_store_get_raw(store, height, &len);
+    if (!data) return NULL;
+    Block* block = block_deserialize_pb(data, len);
+    if (!block) return NULL;
+
+    uint32_t slot = store->cold_next;
+    store->cold_next = (store->cold_next + 1) % BLOCK_STORE_COLD_CACHE;
+    if (store->cold[slot]) block_destroy(store->cold[slot]);
+    store->cold[slot] = block;
+    store->cold_height[slot] = height;
+    return block;
+}
+
+// =============================================================================
+// TRUNCATE
+// =============================================================================
+
+bool block_store_truncate(BlockStore* store, uint64_t height) {
+    if (!store) return false;
+    if (height >= store->count) return true;
+
+    cold_drop_from(store, height);
+
+    const BlockStoreIndex* ix = &store->index[height];
+    uint32_t segment = ix->segment;
+    off_t end = (off_t)ix->offset - RECORD_HEADER;
+
+    unmap_segments_from(store, segment);
+    if (store->fd >= 0) close(store->fd);
+    store->fd = -1;
+
+    char path[512];
+    for (uint32_t later = segment + 1; later <= store->segment; later++) {
+        segment_path(store, later, path, sizeof(path));
+        unlink(path);
+    }
+    segment_path(store, segment, path, sizeof(path));
+    if (truncate(path, end) != 0) {
+        LOG_ERROR("block store: truncate %s failed: %s", path, strerror(errno));
+        return false;
+    }
+
+    store->count = height;
+    if (store->synced_count > height) store->synced_count = height;
+    return open_segment(store, segment);
+}
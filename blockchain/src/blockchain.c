@@ -19,10 +19,11 @@
  * │  ├─ height             Number of blocks (N)                             │
  * │  ├─ last_hash[32]      Hash of latest block (for quick access)          │
  * │  │                                                                       │
- * │  └─ ledger[]           Account states (balance, nonce)                  │
+ * │  └─ ledger[]           Account states (balance, nonce), growable        │
  * │      ├─ ledger[0]      {address, balance, nonce}                        │
  * │      ├─ ledger[1]      {address, balance, nonce}                        │
- * │      └─ ...                                                              │
+ * │      └─ ...            indexed by address (open addressing, 16-slot    │
+ * │                        tag groups probed with one SSE2 compare)         │
  * └──────────────────────────────────────────────────────────────────────────┘
  * 
  * LEDGER MANAGEMENT:
@@ -56,6 +57,14 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <omp.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #ifndef DIAG_OFF
 uint64_t bc_diag_t_validate_ns = 0;
@@ -66,9 +75,18 @@ uint64_t bc_diag_t_commit_ns   = 0;
 // BLOCKCHAIN CREATION
 // =============================================================================
 
-Blockchain* blockchain_create(void) {
+static Blockchain* blockchain_alloc(void) {
     Blockchain* bc = safe_malloc(sizeof(Blockchain));
     memset(bc, 0, sizeof(Blockchain));
+    bc->parallel_apply = true;
+    bc->sync_blocks = BLOCKCHAIN_SYNC_BLOCKS;
+    bc->sync_interval_ms = BLOCKCHAIN_SYNC_MS;
+    bc->snapshot_blocks = BLOCKCHAIN_SNAPSHOT_BLOCKS;
+    return bc;
+}
+
+Blockchain* blockchain_create(void) {
+    Blockchain* bc = blockchain_alloc();
     
     bc->blocks = safe_malloc(MAX_BLOCKS * sizeof(Block*));
     memset(bc->blocks, 0, MAX_BLOCKS * sizeof(Block*));
@@ -88,43 +106,136 @@ Blockchain* blockchain_create(void) {
 // BLOCK MANAGEMENT
 // =============================================================================
 
-bool blockchain_add_block(Blockchain* bc, Block* block) {
+// Re-check the signature of every TX that arrived with full signature material
+// (validator --full-sigs). Legacy TXs carry a 64-byte prefix and no public key:
+// they are counted in *unchecked, and fail the block if require_full is set.
+// In-process repeats (resubmitted blocks) hit the verified-signature cache in
+// tx_view_verify_batch().
+static bool verify_block_signatures(const Block* block, bool require_full,
+                                    uint32_t* checked, uint32_t* unchecked) {
+    uint32_t count = block->header.transaction_count;
+    *checked = 0;
+    *unchecked = 0;
+    if (count == 0) return true;
+
+    TxView** txs = safe_malloc(count * sizeof(TxView*));
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        TxView* tx = block->transactions[i];
+        if (!tx || TX_IS_COINBASE(tx)) continue;
+        if (tx->pubkey_len > 0 && tx->sig_len > 0) txs[n++] = tx;
+        else (*unchecked)++;
+    }
+    if (require_full && *unchecked > 0) {
+        LOG_ERROR("Block #%u: %u TXs without a public key and full signature",
+                  block->header.height, *unchecked);
+        free(txs);
+        return false;
+    }
+    *checked = n;
+    if (n == 0) { free(txs); return true; }
+
+    uint8_t* results = safe_malloc(n);
+    uint32_t failed = 0;
+
+    #pragma omp parallel reduction(+:failed)
+    {
+        uint32_t nth = (uint32_t)omp_get_num_threads();
+        uint32_t tid = (uint32_t)omp_get_thread_num();
+        uint32_t lo = (uint32_t)((uint64_t)n * tid / nth);
+        uint32_t hi = (uint32_t)((uint64_t)n * (tid + 1) / nth);
+        if (hi > lo) {
+            tx_view_verify_batch(&txs[lo], hi - lo, &results[lo]);
+            for (uint32_t i = lo; i < hi; i++) failed += !results[i];
+        }
+    }
+
+    if (failed > 0)
+        LOG_ERROR("Block #%u: %u/%u TX signatures failed re-check",
+                  block->header.height, failed, n);
+
+    free(results);
+    free(txs);
+    return failed == 0;
+}
+
+// Slot of a resident block: every height in memory-only mode, the ring of
+// the last hot_window heights once a block store is attached
+static inline Block** block_slot(const Blockchain* bc, uint64_t height) {
+    return bc->store ? &bc->blocks[height % bc->hot_window] : &bc->blocks[height];
+}
+
+// raw / raw_len: the block's protobuf encoding if the caller already has it
+// (stored as-is), NULL to serialize for the store. adopt: keep block itself
+// instead of a copy.
+static bool add_block(Blockchain* bc, Block* block, const uint8_t* raw, size_t raw_len,
+                      bool adopt) {
     if (!bc || !block) return false;
     
-    if (bc->height >= MAX_BLOCKS) {
-        LOG_ERROR("Blockchain full");
+    if (!bc->store && bc->height >= MAX_BLOCKS) {
+        LOG_ERROR("Blockchain full (attach a block store to go past %d blocks)", MAX_BLOCKS);
         return false;
     }
     
     // Verify block
-    Block* prev_block = bc->height > 0 ? bc->blocks[bc->height - 1] : NULL;
+    Block* prev_block = blockchain_get_last_block(bc);
     if (!block_verify(block, prev_block)) {
         LOG_ERROR("Block verification failed");
         return false;
     }
+    uint32_t sigs_checked, sigs_unchecked;
+    if (!verify_block_signatures(block, bc->require_full_sigs, &sigs_checked, &sigs_unchecked)) {
+        LOG_ERROR("Block signature verification failed");
+        return false;
+    }
 #ifndef DIAG_OFF
     bc_diag_t_validate_ns = get_current_time_ns();
 #endif
 
+    // Persist before touching the ledger, so a failed write leaves no trace
+    if (bc->store) {
+        bool stored = raw ? block_store_append_raw(bc->store, block->header.height, raw, raw_len)
+                          : block_store_append(bc->store, block);
+        if (!stored) {
+            LOG_ERROR("Block store append failed");
+            return false;
+        }
+    }
+
     // Process transactions (update ledger)
     if (!blockchain_process_block(bc, block)) {
         LOG_ERROR("Block transaction processing failed");
+        if (bc->store) block_store_truncate(bc->store, bc->height);
         return false;
     }
 
     // Add to chain
-    Block* block_copy = block_create();
-    memcpy(&block_copy->header, &block->header, sizeof(BlockHeader));
-    block_copy->total_fees = block->total_fees;
-
-    for (uint32_t i = 0; i < block->header.transaction_count; i++) {
-        if (block->transactions[i]) {
-            block_add_transaction(block_copy, block->transactions[i]);
-        }
+    Block* resident;
+    if (adopt) {
+        block_compact(block);
+        resident = block;
+    } else {
+        resident = block_copy(block);
     }
 
-    bc->blocks[bc->height++] = block_copy;
+    // With a store the slot being reused holds height - hot_window, which
+    // from now on is served from disk
+    Block** slot = block_slot(bc, bc->height);
+    if (*slot) block_destroy(*slot);
+    *slot = resident;
+    bc->height++;
     memcpy(bc->last_hash, block->header.hash, 32);
+    bc->sigs_checked += sigs_checked;
+    bc->sigs_unchecked += sigs_unchecked;
+
+    // Group commit: the fdatasync covering this block may be deferred to a
+    // later block or to blockchain_sync_if_due() from the server loop, so the
+    // block is durable only once unsynced_blocks is back to 0. Snapshots are
+    // left to blockchain_snapshot_if_due() between requests.
+    if (bc->store) {
+        if (bc->unsynced_blocks++ == 0) bc->first_unsynced_ms = get_current_time_ms();
+        blockchain_sync_if_due(bc);
+    }
 #ifndef DIAG_OFF
     bc_diag_t_commit_ns = get_current_time_ns();
 #endif
@@ -134,14 +245,73 @@ bool blockchain_add_block(Blockchain* bc, Block* block) {
     return true;
 }
 
+bool blockchain_add_block(Blockchain* bc, Block* block) {
+    return add_block(bc, block, NULL, 0, false);
+}
+
+bool blockchain_adopt_block(Blockchain* bc, Block* block, const uint8_t* raw, size_t raw_len) {
+    if (raw && raw_len == 0) raw = NULL;
+    return add_block(bc, block, raw, raw_len, true);
+}
+
 Block* blockchain_get_block(const Blockchain* bc, uint64_t height) {
     if (!bc || height >= bc->height) return NULL;
-    return bc->blocks[height];
+    if (bc->store && bc->height - height > bc->hot_window)
+        return block_store_get(bc->store, height);
+    return *block_slot(bc, height);
 }
 
 Block* blockchain_get_last_block(const Blockchain* bc) {
     if (!bc || bc->height == 0) return NULL;
-    return bc->blocks[bc->height - 1];
+    return *block_slot(bc, bc->height - 1);
+}
+
+bool blockchain_attach_store(Blockchain* bc, const char* dir, uint32_t hot_blocks) {
+    if (!bc || !dir || bc->store) return false;
+    if (hot_blocks == 0) hot_blocks = BLOCK_STORE_DEFAULT_HOT;
+
+    BlockStore* store = block_store_open(dir);
+    if (!store) return false;
+
+    // Keep the stored prefix only if it belongs to this chain
+    uint64_t stored = block_store_height(store);
+    if (stored > 0) {
+        const Block* genesis = block_store_get(store, 0);
+        if (!genesis || memcmp(genesis->header.hash, bc->blocks[0]->header.hash, 32) != 0) {
+            LOG_WARN("Block store %s holds a different chain (%lu blocks), resetting",
+                     dir, stored);
+            stored = 0;
+        }
+        if (stored > bc->height) stored = bc->height;
+        if (!block_store_truncate(store, stored)) {
+            block_store_close(store);
+            return false;
+        }
+    }
+    for (uint64_t h = stored; h < bc->height; h++) {
+        if (!block_store_append(store, bc->blocks[h])) {
+            block_store_close(store);
+            return false;
+        }
+    }
+
+    // Only the hot tail stays resident
+    Block** ring = safe_malloc(hot_blocks * sizeof(Block*));
+    memset(ring, 0, hot_blocks * sizeof(Block*));
+    for (uint64_t h = 0; h < bc->height; h++) {
+        if (bc->height - h <= hot_blocks) ring[h % hot_blocks] = bc->blocks[h];
+        else block_destroy(bc->blocks[h]);
+    }
+    free(bc->blocks);
+    bc->blocks = ring;
+    bc->hot_window = hot_blocks;
+    bc->store = store;
+    bc->snapshot_height = 0;
+    if (!blockchain_snapshot(bc))
+        LOG_WARN("Initial ledger snapshot failed; restart will replay from genesis");
+
+    LOG_INFO("📦 Block store attached: %s (%u hot blocks)", dir, hot_blocks);
+    return true;
 }
 
 uint64_t blockchain_get_height(const Blockchain* bc) {
@@ -152,64 +322,159 @@ uint64_t blockchain_get_height(const Blockchain* bc) {
 // LEDGER MANAGEMENT
 // =============================================================================
 
-static int find_ledger_entry(const Blockchain* bc, const uint8_t address[20]) {
-    for (uint32_t i = 0; i < bc->ledger_count; i++) {
-        if (memcmp(bc->ledger[i].address, address, 20) == 0) {
-            return (int)i;
+#define LEDGER_NONE  UINT32_MAX
+
+// Addresses are hash outputs, but benchmarks and tests use sparse synthetic
+// ones (a counter in the first bytes), so every byte is mixed in.
+static inline uint64_t ledger_hash(const uint8_t address[20]) {
+    uint64_t a, b;
+    uint32_t c;
+    memcpy(&a, address, 8);
+    memcpy(&b, address + 8, 8);
+    memcpy(&c, address + 16, 4);
+    uint64_t h = a * 0x9E3779B97F4A7C15ULL;
+    h = (h ^ b ^ ((uint64_t)c << 32)) * 0xC2B2AE3D27D4EB4FULL;
+    return h ^ (h >> 29);
+}
+
+// Bitmask of the slots in a group whose control byte equals tag
+static inline uint32_t ledger_group_match(const uint8_t* ctrl, uint8_t tag) {
+#ifdef __SSE2__
+    __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)tag)));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < LEDGER_GROUP_SLOTS; i++)
+        mask |= (uint32_t)(ctrl[i] == tag) << i;
+    return mask;
+#endif
+}
+
+// Entries are never removed, so a probe can stop at the first group that
+// still has an empty slot: the key would have been placed there.
+static uint32_t find_ledger_entry_hashed(const Blockchain* bc, const uint8_t address[20],
+                                         uint64_t h) {
+    if (bc->ledger_slot_count == 0) return LEDGER_NONE;
+
+    uint8_t tag = 0x80 | (uint8_t)(h & 0x7F);
+    uint32_t group_mask = bc->ledger_slot_count / LEDGER_GROUP_SLOTS - 1;
+    uint32_t g = (uint32_t)(h >> 7) & group_mask;
+
+    for (;;) {
+        const uint8_t* ctrl = bc->ledger_ctrl + (size_t)g * LEDGER_GROUP_SLOTS;
+        uint32_t match = ledger_group_match(ctrl, tag);
+        while (match) {
+            uint32_t slot = g * LEDGER_GROUP_SLOTS + (uint32_t)__builtin_ctz(match);
+            uint32_t idx = bc->ledger_slots[slot];
+            if (memcmp(bc->ledger[idx].address, address, 20) == 0) return idx;
+            match &= match - 1;
         }
+        if (ledger_group_match(ctrl, 0)) return LEDGER_NONE;
+        g = (g + 1) & group_mask;
     }
-    return -1;
 }
 
-static int create_ledger_entry(Blockchain* bc, const uint8_t address[20]) {
-    if (bc->ledger_count >= 10000) return -1;
-    
-    int idx = bc->ledger_count++;
+static uint32_t find_ledger_entry(const Blockchain* bc, const uint8_t address[20]) {
+    return find_ledger_entry_hashed(bc, address, ledger_hash(address));
+}
+
+static void ledger_index_insert(Blockchain* bc, uint32_t idx) {
+    uint64_t h = ledger_hash(bc->ledger[idx].address);
+    uint32_t group_mask = bc->ledger_slot_count / LEDGER_GROUP_SLOTS - 1;
+    uint32_t g = (uint32_t)(h >> 7) & group_mask;
+
+    for (;;) {
+        uint8_t* ctrl = bc->ledger_ctrl + (size_t)g * LEDGER_GROUP_SLOTS;
+        uint32_t empty = ledger_group_match(ctrl, 0);
+        if (empty) {
+            uint32_t bit = (uint32_t)__builtin_ctz(empty);
+            ctrl[bit] = 0x80 | (uint8_t)(h & 0x7F);
+            bc->ledger_slots[g * LEDGER_GROUP_SLOTS + bit] = idx;
+            return;
+        }
+        g = (g + 1) & group_mask;
+    }
+}
+
+static void ledger_index_rebuild(Blockchain* bc, uint32_t slot_count) {
+    free(bc->ledger_ctrl);
+    free(bc->ledger_slots);
+    bc->ledger_slot_count = slot_count;
+    bc->ledger_ctrl = safe_malloc(slot_count);
+    memset(bc->ledger_ctrl, 0, slot_count);
+    bc->ledger_slots = safe_malloc((size_t)slot_count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < bc->ledger_count; i++)
+        ledger_index_insert(bc, i);
+}
+
+static uint32_t create_ledger_entry(Blockchain* bc, const uint8_t address[20]) {
+    if (bc->ledger_count == LEDGER_NONE - 1) return LEDGER_NONE;
+
+    if (bc->ledger_count == bc->ledger_capacity) {
+        uint32_t cap = bc->ledger_capacity ? bc->ledger_capacity * 2
+                                           : LEDGER_INITIAL_SLOTS / 2;
+        bc->ledger = safe_realloc(bc->ledger, (size_t)cap * sizeof(LedgerAccount));
+        bc->ledger_capacity = cap;
+    }
+
+    uint32_t idx = bc->ledger_count++;
     memcpy(bc->ledger[idx].address, address, 20);
     bc->ledger[idx].balance = 0;
     bc->ledger[idx].nonce = 0;
-    
+
+    // Keep the index at most 7/8 full so probes stay within a group or two
+    if ((uint64_t)bc->ledger_count * 8 > (uint64_t)bc->ledger_slot_count * 7) {
+        uint32_t slots = bc->ledger_slot_count ? bc->ledger_slot_count * 2
+                                               : LEDGER_INITIAL_SLOTS;
+        ledger_index_rebuild(bc, slots);
+    } else {
+        ledger_index_insert(bc, idx);
+    }
+
     return idx;
 }
 
+static uint32_t find_or_create_ledger_entry(Blockchain* bc, const uint8_t address[20]) {
+    uint32_t idx = find_ledger_entry(bc, address);
+    return idx != LEDGER_NONE ? idx : create_ledger_entry(bc, address);
+}
+
+static void ledger_apply_delta(LedgerAccount* acct, int64_t delta) {
+    if (delta < 0 && acct->balance < (uint64_t)(-delta)) {
+        acct->balance = 0;
+    } else {
+        acct->balance += delta;
+    }
+}
+
 uint64_t blockchain_get_balance(const Blockchain* bc, const uint8_t address[20]) {
     if (!bc) return 0;
     
-    int idx = find_ledger_entry(bc, address);
-    return idx >= 0 ? bc->ledger[idx].balance : 0;
+    uint32_t idx = find_ledger_entry(bc, address);
+    return idx != LEDGER_NONE ? bc->ledger[idx].balance : 0;
 }
 
 uint64_t blockchain_get_nonce(const Blockchain* bc, const uint8_t address[20]) {
     if (!bc) return 0;
     
-    int idx = find_ledger_entry(bc, address);
-    return idx >= 0 ? bc->ledger[idx].nonce : 0;
+    uint32_t idx = find_ledger_entry(bc, address);
+    return idx != LEDGER_NONE ? bc->ledger[idx].nonce : 0;
 }
 
 void blockchain_update_balance(Blockchain* bc, const uint8_t address[20], int64_t delta) {
     if (!bc) return;
     
-    int idx = find_ledger_entry(bc, address);
-    if (idx < 0) {
-        idx = create_ledger_entry(bc, address);
-        if (idx < 0) return;
-    }
+    uint32_t idx = find_or_create_ledger_entry(bc, address);
+    if (idx == LEDGER_NONE) return;
     
-    if (delta < 0 && bc->ledger[idx].balance < (uint64_t)(-delta)) {
-        bc->ledger[idx].balance = 0;
-    } else {
-        bc->ledger[idx].balance += delta;
-    }
+    ledger_apply_delta(&bc->ledger[idx], delta);
 }
 
 void blockchain_update_nonce(Blockchain* bc, const uint8_t address[20], uint64_t nonce) {
     if (!bc) return;
     
-    int idx = find_ledger_entry(bc, address);
-    if (idx < 0) {
-        idx = create_ledger_entry(bc, address);
-        if (idx < 0) return;
-    }
+    uint32_t idx = find_or_create_ledger_entry(bc, address);
+    if (idx == LEDGER_NONE) return;
     
     if (nonce > bc->ledger[idx].nonce) {
         bc->ledger[idx].nonce = nonce;
@@ -225,6 +490,330 @@ void blockchain_credit_address(Blockchain* bc, const uint8_t address[20], uint64
 // BLOCK TRANSACTION PROCESSING
 // =============================================================================
 
+// -----------------------------------------------------------------------------
+// Parallel apply
+// -----------------------------------------------------------------------------
+//
+// Produces exactly the ledger (balances, nonces, account creation order) and
+// log stream of the sequential loop below:
+//
+//   1. Resolve (parallel)   hash + ledger probe for every source/dest address
+//   2. Group (sequential)   block-local account table; per-sender TX lists and
+//                           per-dest credit lists, both kept in block order
+//   3. Debit (parallel)     a sender is "clean" when no credit to it appears
+//                           before its last debit, so its balance checks only
+//                           depend on its start balance and its own TXs
+//   4. Debit (sequential)   remaining "dirty" senders, walking the block in
+//                           order with credits applied as they occur
+//   5. Credit (parallel)    each clean account sums its credit list in block
+//                           order; wrapping u64 adds make the result
+//                           independent of how accounts are split over threads
+//   6. Create (sequential)  accounts that did not exist, in first-use order
+//   7. Write back (parallel) + sequential log/summary pass
+//
+// A funded debit never clamps, so every account ends at start - debits +
+// credits (mod 2^64) exactly as in the sequential path. Blocks whose coinbase
+// value does not fit int64 (negative delta, clamped) fall back to sequential.
+
+#define APPLY_PASS       0x01
+#define APPLY_SKIP       0x02
+#define APPLY_NONCE_LOW  0x04
+#define APPLY_COINBASE   0x08
+
+#define APPLY_NO_POS     UINT32_MAX
+
+typedef struct {
+    uint64_t src_hash, dst_hash;
+    uint32_t src_ledger, dst_ledger;   // Ledger index at block start (or LEDGER_NONE)
+    uint32_t src, dst;                 // Block-local account ids
+    uint64_t seen_nonce;               // Sender nonce / balance when checked (for logs)
+    uint64_t seen_balance;
+    uint8_t  status;
+} ApplyTx;
+
+typedef struct {
+    const uint8_t* address;
+    uint64_t hash;
+    uint32_t ledger;
+    uint32_t first_credit;             // Block position of the first credit
+    uint32_t last_debit;               // Block position of the last debit
+    uint32_t debit_start, debit_count; // Slice of debit_order
+    uint32_t credit_start, credit_count; // Slice of credit_order
+    uint64_t balance;
+    uint64_t nonce;
+    bool dirty;
+} ApplyAccount;
+
+struct ApplyScratch {
+    ApplyTx* txs;
+    ApplyAccount* accts;
+    uint32_t* debit_order;
+    uint32_t* credit_order;
+    uint32_t* table;                   // Address → account id + 1
+    uint32_t tx_cap;
+    uint32_t table_size;
+};
+
+typedef struct {
+    uint64_t total_fees_collected;
+    uint64_t coinbase_amount;
+    char farmer_addr[41];
+    uint32_t regular_tx_count;
+    uint32_t skipped_tx_count;
+} ApplySummary;
+
+// Scratch is kept on the Blockchain and only grows, so steady-state blocks
+// reuse already-faulted pages.
+static struct ApplyScratch* apply_scratch(Blockchain* bc, uint32_t n) {
+    struct ApplyScratch* s = bc->apply_scratch;
+    if (!s) {
+        s = safe_malloc(sizeof(*s));
+        memset(s, 0, sizeof(*s));
+        bc->apply_scratch = s;
+    }
+    if (n > s->tx_cap) {
+        free(s->txs); free(s->accts); free(s->debit_order);
+        free(s->credit_order); free(s->table);
+        s->tx_cap = n;
+        s->table_size = 1024;
+        while (s->table_size < 4 * n) s->table_size *= 2;   // ≤ 2n accounts: ≤ 50% load
+        s->txs = safe_malloc((size_t)n * sizeof(ApplyTx));
+        s->accts = safe_malloc((size_t)2 * n * sizeof(ApplyAccount));
+        s->debit_order = safe_malloc((size_t)n * sizeof(uint32_t));
+        s->credit_order = safe_malloc((size_t)n * sizeof(uint32_t));
+        s->table = safe_malloc((size_t)s->table_size * sizeof(uint32_t));
+    }
+    return s;
+}
+
+static void apply_scratch_free(struct ApplyScratch* s) {
+    if (!s) return;
+    free(s->txs); free(s->accts); free(s->debit_order);
+    free(s->credit_order); free(s->table);
+    free(s);
+}
+
+static uint32_t apply_account(struct ApplyScratch* s, uint32_t* count,
+                              const uint8_t address[20], uint64_t hash, uint32_t ledger) {
+    uint32_t mask = s->table_size - 1;
+    for (uint32_t slot = (uint32_t)hash & mask;; slot = (slot + 1) & mask) {
+        uint32_t id = s->table[slot];
+        if (id == 0) {
+            id = (*count)++;
+            ApplyAccount* a = &s->accts[id];
+            memset(a, 0, sizeof(*a));
+            a->address = address;
+            a->hash = hash;
+            a->ledger = ledger;
+            a->first_credit = APPLY_NO_POS;
+            s->table[slot] = id + 1;
+            return id;
+        }
+        ApplyAccount* a = &s->accts[id - 1];
+        if (a->hash == hash && memcmp(a->address, address, 20) == 0) return id - 1;
+    }
+}
+
+static void apply_debit(ApplyAccount* src, const TxView* tx, ApplyTx* at) {
+    at->seen_nonce = src->nonce;
+    at->seen_balance = src->balance;
+    if (tx->nonce < src->nonce) at->status |= APPLY_NONCE_LOW;
+
+    uint64_t required = tx->value + tx->fee;
+    if (src->balance < required) {
+        at->status |= APPLY_SKIP;
+        return;
+    }
+    if (tx->nonce + 1 > src->nonce) src->nonce = tx->nonce + 1;
+    src->balance -= required;
+    at->status |= APPLY_PASS;
+}
+
+// value + fee must fit the signed ledger delta. A larger value would be
+// clamped by ledger_apply_delta() and a wrapped value + fee would pass the
+// balance check, so such TXs are rejected in both apply paths.
+static inline bool tx_amount_in_range(const TxView* tx) {
+    return tx->value <= (uint64_t)INT64_MAX - tx->fee;
+}
+
+static void apply_ensure_account(Blockchain* bc, ApplyAccount* a) {
+    if (a->ledger == LEDGER_NONE) a->ledger = create_ledger_entry(bc, a->address);
+}
+
+static bool apply_block_parallel(Blockchain* bc, const Block* block, ApplySummary* sum) {
+    uint32_t n = block->header.transaction_count;
+    TxView* const* txs = block->transactions;
+
+    // Out-of-range amounts are rejected (and logged) by the sequential path
+    for (uint32_t i = 0; i < n; i++) {
+        if (txs[i] && !tx_amount_in_range(txs[i])) return false;
+    }
+
+    struct ApplyScratch* s = apply_scratch(bc, n);
+    ApplyTx* at = s->txs;
+
+    // 1. Resolve: the ledger index is read-only until step 6
+    #pragma omp parallel
+    {
+        uint32_t nth = (uint32_t)omp_get_num_threads();
+        uint32_t tid = (uint32_t)omp_get_thread_num();
+        uint32_t lo = (uint32_t)((uint64_t)n * tid / nth);
+        uint32_t hi = (uint32_t)((uint64_t)n * (tid + 1) / nth);
+        for (uint32_t i = lo; i < hi; i++) {
+            const TxView* tx = txs[i];
+            at[i].status = 0;
+            if (!tx) continue;
+            at[i].dst_hash = ledger_hash(tx->dest_address);
+            at[i].dst_ledger = find_ledger_entry_hashed(bc, tx->dest_address, at[i].dst_hash);
+            if (TX_IS_COINBASE(tx)) {
+                at[i].status = APPLY_COINBASE;
+            } else {
+                at[i].src_hash = ledger_hash(tx->source_address);
+                at[i].src_ledger = find_ledger_entry_hashed(bc, tx->source_address,
+                                                            at[i].src_hash);
+            }
+        }
+    }
+
+    // 2. Group
+    memset(s->table, 0, (size_t)s->table_size * sizeof(uint32_t));
+    uint32_t nacct = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const TxView* tx = txs[i];
+        if (!tx) continue;
+        if (!(at[i].status & APPLY_COINBASE)) {
+            uint32_t src = apply_account(s, &nacct, tx->source_address,
+                                         at[i].src_hash, at[i].src_ledger);
+            at[i].src = src;
+            s->accts[src].last_debit = i;
+            s->accts[src].debit_count++;
+        }
+        uint32_t dst = apply_account(s, &nacct, tx->dest_address,
+                                     at[i].dst_hash, at[i].dst_ledger);
+        at[i].dst = dst;
+        if (s->accts[dst].first_credit == APPLY_NO_POS) s->accts[dst].first_credit = i;
+        s->accts[dst].credit_count++;
+    }
+
+    uint32_t debit_pos = 0, credit_pos = 0, dirty = 0, missing = 0;
+    for (uint32_t a = 0; a < nacct; a++) {
+        ApplyAccount* acct = &s->accts[a];
+        acct->debit_start = debit_pos;
+        acct->credit_start = credit_pos;
+        debit_pos += acct->debit_count;
+        credit_pos += acct->credit_count;
+        acct->debit_count = acct->credit_count = 0;   // refilled below
+        acct->dirty = acct->first_credit < acct->last_debit && acct->debit_start != debit_pos;
+        dirty += acct->dirty;
+        missing += acct->ledger == LEDGER_NONE;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        if (!txs[i]) continue;
+        if (!(at[i].status & APPLY_COINBASE)) {
+            ApplyAccount* src = &s->accts[at[i].src];
+            s->debit_order[src->debit_start + src->debit_count++] = i;
+        }
+        ApplyAccount* dst = &s->accts[at[i].dst];
+        s->credit_order[dst->credit_start + dst->credit_count++] = i;
+    }
+
+    // 3. Debit clean senders
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (uint32_t a = 0; a < nacct; a++) {
+        ApplyAccount* acct = &s->accts[a];
+        if (acct->ledger != LEDGER_NONE) {
+            acct->balance = bc->ledger[acct->ledger].balance;
+            acct->nonce = bc->ledger[acct->ledger].nonce;
+        }
+        if (acct->dirty) continue;
+        for (uint32_t k = 0; k < acct->debit_count; k++) {
+            uint32_t i = s->debit_order[acct->debit_start + k];
+            apply_debit(acct, txs[i], &at[i]);
+        }
+    }
+
+    // 4. Debit dirty senders in block order; they see every earlier credit
+    if (dirty > 0) {
+        for (uint32_t i = 0; i < n; i++) {
+            if (!txs[i]) continue;
+            ApplyAccount* dst = &s->accts[at[i].dst];
+            if (!(at[i].status & APPLY_COINBASE)) {
+                ApplyAccount* src = &s->accts[at[i].src];
+                if (src->dirty) apply_debit(src, txs[i], &at[i]);
+                if (!(at[i].status & APPLY_PASS)) continue;
+            }
+            if (dst->dirty) dst->balance += txs[i]->value;
+        }
+    }
+
+    // 5. Credit clean accounts
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (uint32_t a = 0; a < nacct; a++) {
+        ApplyAccount* acct = &s->accts[a];
+        if (acct->dirty) continue;
+        for (uint32_t k = 0; k < acct->credit_count; k++) {
+            uint32_t i = s->credit_order[acct->credit_start + k];
+            if (at[i].status & (APPLY_PASS | APPLY_COINBASE))
+                acct->balance += txs[i]->value;
+        }
+    }
+
+    // 6. Create missing accounts where the sequential path would have
+    if (missing > 0) {
+        for (uint32_t i = 0; i < n; i++) {
+            if (at[i].status & APPLY_PASS) {
+                apply_ensure_account(bc, &s->accts[at[i].src]);
+                apply_ensure_account(bc, &s->accts[at[i].dst]);
+            } else if (at[i].status & APPLY_COINBASE) {
+                apply_ensure_account(bc, &s->accts[at[i].dst]);
+            }
+        }
+    }
+
+    // 7. Write back
+    #pragma omp parallel for schedule(static)
+    for (uint32_t a = 0; a < nacct; a++) {
+        const ApplyAccount* acct = &s->accts[a];
+        if (acct->ledger == LEDGER_NONE) continue;
+        bc->ledger[acct->ledger].balance = acct->balance;
+        bc->ledger[acct->ledger].nonce = acct->nonce;
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        const TxView* tx = txs[i];
+        if (!tx) continue;
+        if (at[i].status & APPLY_COINBASE) {
+            sum->coinbase_amount = tx->value;
+            bytes_to_hex_buf(tx->dest_address, 20, sum->farmer_addr);
+            LOG_INFO("💎 COINBASE: +%lu coins → %.16s...", tx->value, sum->farmer_addr);
+            continue;
+        }
+        sum->regular_tx_count++;
+        if (at[i].status & APPLY_NONCE_LOW) {
+            LOG_WARN("Transaction nonce too low: %lu < %lu", tx->nonce, at[i].seen_nonce);
+        }
+        if (at[i].status & APPLY_SKIP) {
+            char addr_hex[41];
+            bytes_to_hex_buf(tx->source_address, 20, addr_hex);
+            LOG_WARN("⚠️  TX rejected: insufficient balance. %.16s... has %lu, needs %lu",
+                     addr_hex, at[i].seen_balance, tx->value + tx->fee);
+            sum->skipped_tx_count++;
+            continue;
+        }
+        sum->total_fees_collected += tx->fee;
+    }
+
+    return true;
+}
+
+void blockchain_set_parallel_apply(Blockchain* bc, bool enabled) {
+    if (bc) bc->parallel_apply = enabled;
+}
+
+void blockchain_set_require_full_sigs(Blockchain* bc, bool enabled) {
+    if (bc) bc->require_full_sigs = enabled;
+}
+
 bool blockchain_process_block(Blockchain* bc, const Block* block) {
     if (!bc || !block) return false;
     
@@ -234,10 +823,35 @@ bool blockchain_process_block(Blockchain* bc, const Block* block) {
     uint32_t regular_tx_count = 0;
     uint32_t skipped_tx_count = 0;
     
-    for (uint32_t i = 0; i < block->header.transaction_count; i++) {
-        Transaction* tx = block->transactions[i];
+    bool applied = false;
+    if (bc->parallel_apply && block->header.transaction_count >= PARALLEL_APPLY_MIN_TXS &&
+        omp_get_max_threads() > 1) {
+        ApplySummary sum;
+        memset(&sum, 0, sizeof(sum));
+        applied = apply_block_parallel(bc, block, &sum);
+        if (applied) {
+            total_fees_collected = sum.total_fees_collected;
+            coinbase_amount = sum.coinbase_amount;
+            memcpy(farmer_addr, sum.farmer_addr, sizeof(farmer_addr));
+            regular_tx_count = sum.regular_tx_count;
+            skipped_tx_count = sum.skipped_tx_count;
+        }
+    }
+    
+    for (uint32_t i = 0; !applied && i < block->header.transaction_count; i++) {
+        TxView* tx = block->transactions[i];
         if (!tx) continue;
         
+        if (!tx_amount_in_range(tx)) {
+            LOG_WARN("⚠️  TX rejected: amount out of range (value %lu, fee %u)",
+                     tx->value, tx->fee);
+            if (!TX_IS_COINBASE(tx)) {
+                regular_tx_count++;
+                skipped_tx_count++;
+            }
+            continue;
+        }
+
         if (TX_IS_COINBASE(tx)) {
             // Coinbase: credit destination with mining_reward + fees
             blockchain_update_balance(bc, tx->dest_address, tx->value);
@@ -249,7 +863,9 @@ bool blockchain_process_block(Blockchain* bc, const Block* block) {
             regular_tx_count++;
             
             // Regular transaction: verify nonce, CHECK BALANCE, debit source, credit dest
-            uint64_t expected_nonce = blockchain_get_nonce(bc, tx->source_address);
+            // (one index probe for the sender covers the nonce, balance and debit)
+            uint32_t src = find_ledger_entry(bc, tx->source_address);
+            uint64_t expected_nonce = src != LEDGER_NONE ? bc->ledger[src].nonce : 0;
             if (tx->nonce < expected_nonce) {
                 LOG_WARN("Transaction nonce too low: %lu < %lu", tx->nonce, expected_nonce);
             }
@@ -258,7 +874,7 @@ bool blockchain_process_block(Blockchain* bc, const Block* block) {
             // Without this check, coins are created from thin air when a sender
             // has 0 balance — the deduction silently underflows to 0 but the
             // receiver and miner are still credited.
-            uint64_t sender_balance = blockchain_get_balance(bc, tx->source_address);
+            uint64_t sender_balance = src != LEDGER_NONE ? bc->ledger[src].balance : 0;
             uint64_t required = tx->value + tx->fee;
             if (sender_balance < required) {
                 char addr_hex[41];
@@ -269,11 +885,16 @@ bool blockchain_process_block(Blockchain* bc, const Block* block) {
                 continue;  // Skip this TX entirely — don't debit, don't credit
             }
             
-            // Update nonce
-            blockchain_update_nonce(bc, tx->source_address, tx->nonce + 1);
-            
-            // Transfer value + fee from source
-            blockchain_update_balance(bc, tx->source_address, -(int64_t)(tx->value + tx->fee));
+            if (src == LEDGER_NONE) src = create_ledger_entry(bc, tx->source_address);
+            if (src != LEDGER_NONE) {
+                // Update nonce
+                if (tx->nonce + 1 > bc->ledger[src].nonce) {
+                    bc->ledger[src].nonce = tx->nonce + 1;
+                }
+                
+                // Transfer value + fee from source
+                ledger_apply_delta(&bc->ledger[src], -(int64_t)(tx->value + tx->fee));
+            }
             
             // Credit destination (only value, not fee)
             blockchain_update_balance(bc, tx->dest_address, tx->value);
@@ -313,7 +934,7 @@ bool blockchain_verify(const Blockchain* bc) {
     if (!bc || bc->height == 0) return false;
     
     for (uint64_t i = 1; i < bc->height; i++) {
-        if (!block_verify(bc->blocks[i], bc->blocks[i-1])) {
+        if (!block_verify(blockchain_get_block(bc, i), blockchain_get_block(bc, i - 1))) {
             LOG_ERROR("Chain verification failed at block %lu", i);
             return false;
         }
@@ -339,7 +960,7 @@ bool blockchain_save_pb(const Blockchain* bc, const char* filepath) {
     // Write each block
     for (uint64_t i = 0; i < bc->height; i++) {
         size_t block_len;
-        uint8_t* block_data = block_serialize_pb(bc->blocks[i], &block_len);
+        uint8_t* block_data = block_serialize_pb(blockchain_get_block(bc, i), &block_len);
         if (block_data) {
             fwrite(&block_len, sizeof(size_t), 1, f);
             fwrite(block_data, 1, block_len, f);
@@ -364,8 +985,7 @@ Blockchain* blockchain_load_pb(const char* filepath) {
     FILE* f = fopen(filepath, "rb");
     if (!f) return NULL;
     
-    Blockchain* bc = safe_malloc(sizeof(Blockchain));
-    memset(bc, 0, sizeof(Blockchain));
+    Blockchain* bc = blockchain_alloc();
     bc->blocks = safe_malloc(MAX_BLOCKS * sizeof(Block*));
     memset(bc->blocks, 0, MAX_BLOCKS * sizeof(Block*));
     
@@ -385,12 +1005,20 @@ Blockchain* blockchain_load_pb(const char* filepath) {
         free(block_data);
     }
     
-    // Read ledger
-    fread(&bc->ledger_count, sizeof(uint32_t), 1, f);
-    for (uint32_t i = 0; i < bc->ledger_count; i++) {
-        fread(bc->ledger[i].address, 20, 1, f);
-        fread(&bc->ledger[i].balance, sizeof(uint64_t), 1, f);
-        fread(&bc->ledger[i].nonce, sizeof(uint64_t), 1, f);
+    // Read ledger (index is rebuilt entry by entry)
+    uint32_t ledger_count = 0;
+    fread(&ledger_count, sizeof(uint32_t), 1, f);
+    for (uint32_t i = 0; i < ledger_count; i++) {
+        LedgerAccount acct;
+        if (fread(acct.address, 20, 1, f) != 1 ||
+            fread(&acct.balance, sizeof(uint64_t), 1, f) != 1 ||
+            fread(&acct.nonce, sizeof(uint64_t), 1, f) != 1) {
+            LOG_WARN("Ledger truncated at entry %u/%u", i, ledger_count);
+            break;
+        }
+        uint32_t idx = find_or_create_ledger_entry(bc, acct.address);
+        if (idx == LEDGER_NONE) break;
+        bc->ledger[idx] = acct;
     }
     
     fclose(f);
@@ -398,18 +1026,385 @@ Blockchain* blockchain_load_pb(const char* filepath) {
     return bc;
 }
 
+// =============================================================================
+// PERSISTENCE (block store + ledger snapshots)
+// =============================================================================
+//
+// With a store attached the segment files are the write-ahead log: a block is
+// appended before the ledger is touched, and fdatasync is issued per group
+// (sync_blocks blocks or sync_interval_ms, whichever comes first) instead of
+// per block. Every snapshot_blocks blocks (blockchain_snapshot_if_due, run by
+// the server between requests) the ledger is written to
+//
+//   <dir>/ledger_<height>.snap
+//   [8] "QMEMSNAP" [4] version [8] height [32] hash of block height-1
+//   [4] account count, then per account [20] address [8] balance [8] nonce
+//   [32] BLAKE3 of everything before it
+//
+// via a temp file + rename, after syncing the log up to that height. A restart
+// loads the newest snapshot whose hash matches the stored block at that
+// height and replays only the blocks after it.
+
+#define SNAP_MAGIC        "QMEMSNAP"
+#define SNAP_VERSION      1
+#define SNAP_HEADER       56
+#define SNAP_ACCOUNT      36
+#define SNAP_BATCH        4096            // Accounts per write / read
+
+void blockchain_set_persistence(Blockchain* bc, uint32_t sync_blocks,
+                                uint32_t sync_interval_ms, uint32_t snapshot_blocks) {
+    if (!bc) return;
+    bc->sync_blocks = sync_blocks;
+    bc->sync_interval_ms = sync_interval_ms;
+    bc->snapshot_blocks = snapshot_blocks;
+}
+
+bool blockchain_sync(Blockchain* bc) {
+    if (!bc || !bc->store) return false;
+    if (!block_store_sync(bc->store)) return false;
+    bc->unsynced_blocks = 0;
+    return true;
+}
+
+bool blockchain_sync_if_due(Blockchain* bc) {
+    if (!bc || !bc->store || bc->unsynced_blocks == 0) return true;
+    bool due = (bc->sync_blocks > 0 && bc->unsynced_blocks >= bc->sync_blocks) ||
+               (bc->sync_interval_ms > 0 &&
+                get_current_time_ms() - bc->first_unsynced_ms >= bc->sync_interval_ms);
+    return due ? blockchain_sync(bc) : true;
+}
+
+bool blockchain_snapshot_if_due(Blockchain* bc) {
+    if (!bc || !bc->store || bc->snapshot_blocks == 0 ||
+        bc->height - bc->snapshot_height < bc->snapshot_blocks)
+        return true;
+    return blockchain_snapshot(bc);
+}
+
+static void snapshot_path(const char* dir, uint64_t height, bool tmp, char* out, size_t size) {
+    snprintf(out, size, "%s/ledger_%012lu.snap%s", dir, height, tmp ? ".tmp" : "");
+}
+
+// Snapshot heights in dir, newest first; *count entries (caller frees)
+static uint64_t* list_snapshots(const char* dir, uint32_t* count) {
+    *count = 0;
+    DIR* d = opendir(dir);
+    if (!d) return NULL;
+
+    uint64_t* heights = NULL;
+    uint32_t capacity = 0;
+    struct dirent* e;
+    while ((e = readdir(d)) != NULL) {
+        unsigned long h;
+        char tail[8];
+        if (sscanf(e->d_name, "ledger_%lu.%7s", &h, tail) != 2 || strcmp(tail, "snap") != 0)
+            continue;
+        if (*count == capacity) {
+            capacity = capacity ? capacity * 2 : 8;
+            heights = safe_realloc(heights, capacity * sizeof(uint64_t));
+        }
+        heights[(*count)++] = h;
+    }
+    closedir(d);
+
+    for (uint32_t i = 1; i < *count; i++) {
+        uint64_t h = heights[i];
+        uint32_t j = i;
+        for (; j > 0 && heights[j - 1] < h; j--) heights[j] = heights[j - 1];
+        heights[j] = h;
+    }
+    return heights;
+}
+
+// Keep the newest snapshot and the one before it (fallback if the newest is
+// damaged); remove older ones and temp files left by an interrupted write
+static void prune_snapshots(const char* dir) {
+    uint32_t count = 0;
+    uint64_t* heights = list_snapshots(dir, &count);
+    char path[512];
+    for (uint32_t i = 2; i < count; i++) {
+        snapshot_path(dir, heights[i], false, path, sizeof(path));
+        unlink(path);
+    }
+    free(heights);
+
+    DIR* d = opendir(dir);
+    if (!d) return;
+    struct dirent* e;
+    while ((e = readdir(d)) != NULL) {
+        size_t len = strlen(e->d_name);
+        if (strncmp(e->d_name, "ledger_", 7) == 0 && len > 4 &&
+            strcmp(e->d_name + len - 4, ".tmp") == 0) {
+            snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+            unlink(path);
+        }
+    }
+    closedir(d);
+}
+
+bool blockchain_snapshot(Blockchain* bc) {
+    if (!bc || !bc->store || bc->height == 0) return false;
+
+    // The snapshot must never be ahead of the durable log
+    if (!blockchain_sync(bc)) return false;
+
+    uint64_t t0 = get_current_time_ms();
+    const char* dir = bc->store->dir;
+    char tmp[512], path[512];
+    snapshot_path(dir, bc->height, true, tmp, sizeof(tmp));
+    snapshot_path(dir, bc->height, false, path, sizeof(path));
+
+    FILE* f = fopen(tmp, "wb");
+    if (!f) {
+        LOG_ERROR("Snapshot: cannot create %s: %s", tmp, strerror(errno));
+        return false;
+    }
+
+    blake3_hasher hasher;
+    blake3_hasher_init(&hasher);
+
+    uint8_t header[SNAP_HEADER];
+    uint32_t version = SNAP_VERSION;
+    memcpy(header, SNAP_MAGIC, 8);
+    memcpy(header + 8, &version, 4);
+    memcpy(header + 12, &bc->height, 8);
+    memcpy(header + 20, bc->last_hash, 32);
+    memcpy(header + 52, &bc->ledger_count, 4);
+    blake3_hasher_update(&hasher, header, SNAP_HEADER);
+    bool ok = fwrite(header, SNAP_HEADER, 1, f) == 1;
+
+    uint8_t* batch = safe_malloc(SNAP_BATCH * SNAP_ACCOUNT);
+    for (uint32_t i = 0; ok && i < bc->ledger_count; i += SNAP_BATCH) {
+        uint32_t n = bc->ledger_count - i < SNAP_BATCH ? bc->ledger_count - i : SNAP_BATCH;
+        for (uint32_t j = 0; j < n; j++) {
+            const LedgerAccount* a = &bc->ledger[i + j];
+            uint8_t* out = batch + (size_t)j * SNAP_ACCOUNT;
+            memcpy(out, a->address, 20);
+            memcpy(out + 20, &a->balance, 8);
+            memcpy(out + 28, &a->nonce, 8);
+        }
+        blake3_hasher_update(&hasher, batch, (size_t)n * SNAP_ACCOUNT);
+        ok = fwrite(batch, SNAP_ACCOUNT, n, f) == n;
+    }
+    free(batch);
+
+    uint8_t digest[32];
+    blake3_hasher_finalize(&hasher, digest, 32);
+    ok = ok && fwrite(digest, 32, 1, f) == 1;
+    ok = ok && fflush(f) == 0 && fsync(fileno(f)) == 0;
+    ok = (fclose(f) == 0) && ok;
+    if (!ok || rename(tmp, path) != 0) {
+        LOG_ERROR("Snapshot: writing %s failed: %s", path, strerror(errno));
+        unlink(tmp);
+        return false;
+    }
+
+    int dfd = open(dir, O_RDONLY | O_DIRECTORY);
+    if (dfd >= 0) {
+        fsync(dfd);
+        close(dfd);
+    }
+    bc->snapshot_height = bc->height;
+    prune_snapshots(dir);
+
+    LOG_INFO("📸 Ledger snapshot at height %lu (%u accounts, %lu ms)",
+             bc->height, bc->ledger_count, get_current_time_ms() - t0);
+    return true;
+}
+
+static void ledger_reset(Blockchain* bc) {
+    free(bc->ledger);
+    free(bc->ledger_ctrl);
+    free(bc->ledger_slots);
+    bc->ledger = NULL;
+    bc->ledger_ctrl = NULL;
+    bc->ledger_slots = NULL;
+    bc->ledger_count = 0;
+    bc->ledger_capacity = 0;
+    bc->ledger_slot_count = 0;
+}
+
+// Load one snapshot into an empty ledger; false (ledger left partial) if it
+// is damaged or does not belong to the stored chain
+static bool load_snapshot(Blockchain* bc, uint64_t height) {
+    char path[512];
+    snapshot_path(bc->store->dir, height, false, path, sizeof(path));
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+
+    blake3_hasher hasher;
+    blake3_hasher_init(&hasher);
+
+    uint8_t header[SNAP_HEADER];
+    uint32_t version = 0, count = 0;
+    uint64_t snap_height = 0;
+    bool ok = fread(header, SNAP_HEADER, 1, f) == 1;
+    if (ok) {
+        memcpy(&version, header + 8, 4);
+        memcpy(&snap_height, header + 12, 8);
+        memcpy(&count, header + 52, 4);
+        const Block* last = block_store_get(bc->store, height - 1);
+        ok = memcmp(header, SNAP_MAGIC, 8) == 0 && version == SNAP_VERSION &&
+             snap_height == height && last &&
+             memcmp(header + 20, last->header.hash, 32) == 0;
+    }
+    if (ok) blake3_hasher_update(&hasher, header, SNAP_HEADER);
+
+    uint8_t* batch = safe_malloc(SNAP_BATCH * SNAP_ACCOUNT);
+    for (uint32_t i = 0; ok && i < count; i += SNAP_BATCH) {
+        uint32_t n = count - i < SNAP_BATCH ? count - i : SNAP_BATCH;
+        if (fread(batch, SNAP_ACCOUNT, n, f) != n) {
+            ok = false;
+            break;
+        }
+        blake3_hasher_update(&hasher, batch, (size_t)n * SNAP_ACCOUNT);
+        for (uint32_t j = 0; j < n; j++) {
+            const uint8_t* in = batch + (size_t)j * SNAP_ACCOUNT;
+            uint32_t idx = find_or_create_ledger_entry(bc, in);
+            if (idx == LEDGER_NONE) {
+                ok = false;
+                break;
+            }
+            memcpy(&bc->ledger[idx].balance, in + 20, 8);
+            memcpy(&bc->ledger[idx].nonce, in + 28, 8);
+        }
+    }
+    free(batch);
+
+    uint8_t digest[32], stored_digest[32];
+    if (ok) {
+        blake3_hasher_finalize(&hasher, digest, 32);
+        ok = fread(stored_digest, 32, 1, f) == 1 && memcmp(digest, stored_digest, 32) == 0;
+    }
+    fclose(f);
+    if (!ok) LOG_WARN("Snapshot %s is damaged or stale, skipping", path);
+    return ok;
+}
+
+Blockchain* blockchain_open(const char* dir, uint32_t hot_blocks) {
+    if (!dir) return NULL;
+    if (hot_blocks == 0) hot_blocks = BLOCK_STORE_DEFAULT_HOT;
+
+    BlockStore* store = block_store_open(dir);
+    if (!store) return NULL;
+    if (block_store_height(store) == 0) {
+        block_store_close(store);
+        Blockchain* bc = blockchain_create();
+        if (bc && !blockchain_attach_store(bc, dir, hot_blocks)) {
+            blockchain_destroy(bc);
+            return NULL;
+        }
+        return bc;
+    }
+
+    uint64_t t0 = get_current_time_ms();
+    Blockchain* bc = blockchain_alloc();
+    bc->store = store;
+    bc->hot_window = hot_blocks;
+    bc->blocks = safe_malloc(hot_blocks * sizeof(Block*));
+    memset(bc->blocks, 0, hot_blocks * sizeof(Block*));
+
+    // Newest usable snapshot; without one the whole log is replayed
+    uint64_t stored = block_store_height(store);
+    uint32_t snap_count = 0;
+    uint64_t* snaps = list_snapshots(dir, &snap_count);
+    uint64_t start = 0;
+    for (uint32_t i = 0; i < snap_count; i++) {
+        if (snaps[i] == 0 || snaps[i] > stored) continue;
+        if (load_snapshot(bc, snaps[i])) {
+            start = snaps[i];
+            break;
+        }
+        ledger_reset(bc);
+    }
+    free(snaps);
+    bc->snapshot_height = start;
+    bc->height = start;
+    if (start > 0) {
+        const Block* last = block_store_get(store, start - 1);
+        memcpy(bc->last_hash, last->header.hash, 32);
+    }
+
+    // Replay the tail. Signature checks are skipped: every logged block was
+    // already checked when it was appended, so only linkage and hashes are
+    // re-verified before applying.
+    Block* prev = start > 0 ? block_store_get(store, start - 1) : NULL;
+    Block* prev_owned = NULL;
+    for (uint64_t h = start; h < stored; h++) {
+        size_t len = 0;
+        const uint8_t* raw = block_store_get_raw(store, h, &len);
+        Block* block = raw ? block_deserialize_pb(raw, len) : NULL;
+        bool ok = block && block->header.height == h &&
+                  (h == 0 || block_verify(block, prev)) &&
+                  blockchain_process_block(bc, block);
+        if (!ok) {
+            LOG_WARN("Replay stopped at block %lu, truncating the log there", h);
+            if (block) block_destroy(block);
+            block_store_truncate(store, h);
+            break;
+        }
+
+        bc->height = h + 1;
+        memcpy(bc->last_hash, block->header.hash, 32);
+        if (prev_owned) block_destroy(prev_owned);
+        if (stored - h <= hot_blocks) {
+            block_compact(block);
+            bc->blocks[h % hot_blocks] = block;   // stays resident
+            prev_owned = NULL;
+        } else {
+            prev_owned = block;
+        }
+        prev = block;
+    }
+    if (prev_owned) block_destroy(prev_owned);
+
+    if (bc->height == 0) {
+        // Not even genesis survived: start a new chain in the emptied store
+        blockchain_destroy(bc);
+        bc = blockchain_create();
+        if (bc && !blockchain_attach_store(bc, dir, hot_blocks)) {
+            blockchain_destroy(bc);
+            return NULL;
+        }
+        return bc;
+    }
+
+    // Blocks of the hot window that predate the snapshot were not replayed
+    for (uint64_t h = bc->height > hot_blocks ? bc->height - hot_blocks : 0; h < bc->height; h++) {
+        Block** slot = &bc->blocks[h % hot_blocks];
+        if (*slot && (*slot)->header.height == h) continue;
+        if (*slot) block_destroy(*slot);
+        size_t len = 0;
+        const uint8_t* raw = block_store_get_raw(store, h, &len);
+        *slot = raw ? block_deserialize_pb(raw, len) : NULL;
+        block_compact(*slot);
+    }
+
+    LOG_INFO("📂 Chain opened from %s: %lu blocks, %u accounts "
+             "(snapshot at %lu, replayed %lu blocks, %lu ms)",
+             dir, bc->height, bc->ledger_count, start, bc->height - start,
+             get_current_time_ms() - t0);
+    return bc;
+}
+
 void blockchain_destroy(Blockchain* bc) {
     if (!bc) return;
     
     if (bc->blocks) {
-        for (uint64_t i = 0; i < bc->height; i++) {
+        uint64_t resident = bc->store ? bc->hot_window : bc->height;
+        for (uint64_t i = 0; i < resident; i++) {
             if (bc->blocks[i]) {
                 block_destroy(bc->blocks[i]);
             }
         }
         free(bc->blocks);
     }
+    block_store_close(bc->store);
     
+    free(bc->ledger);
+    free(bc->ledger_ctrl);
+    free(bc->ledger_slots);
+    apply_scratch_free(bc->apply_scratch);
     free(bc);
 }
 
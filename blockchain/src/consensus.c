@@ -47,6 +47,13 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <stddef.h>
+#include <omp.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 // ============================================================================
 // PLOT CREATION
@@ -69,8 +76,36 @@
 // │         ├─ entry[1]  = {nonce: 1, hash: BLAKE3(plot_id||1)}      │
 // │         └─ ...                                                    │
 // └──────────────────────────────────────────────────────────────────┘
+//
+// COMPACT PLOTS:
+// The hash of an entry is a function of (plot_id, nonce), so a compact
+// plot keeps only what the search needs: the leading PLOT_COMPACT_PREFIX
+// hash bytes to sort and binary-search on, and the nonce. The full hash
+// of the ~5 entries plot_find_proof() looks at is recomputed, exactly as
+// proof_verify() does. 12 bytes per entry instead of 32: a k=30 plot is
+// 12 GB instead of 32 GB. Quality is unchanged; only the 64-bit order of
+// entries sharing a prefix is lost, and the search window covers those.
 // ============================================================================
 
+// plot_create() allocates compact entries instead of full ones
+static bool plot_compact_mode = false;
+
+void plot_set_compact(bool compact) {
+    plot_compact_mode = compact;
+}
+
+// Unique plot_id: BLAKE3(farmer_address || timestamp || k_param)
+// This ensures each plot is unique even for same farmer
+static void plot_derive_id(const uint8_t farmer_address[20], uint32_t k_param,
+                           uint8_t plot_id[32]) {
+    uint64_t ts = get_current_timestamp();
+    uint8_t buffer[20 + 8 + 4];
+    memcpy(buffer, farmer_address, 20);
+    memcpy(buffer + 20, &ts, 8);
+    memcpy(buffer + 28, &k_param, 4);
+    blake3_hash(buffer, sizeof(buffer), plot_id);
+}
+
 Plot* plot_create(const uint8_t farmer_address[20], uint32_t k_param) {
     // Validate k parameter (too small = insecure, too large = impractical)
     if (k_param < K_PARAM_MIN || k_param > K_PARAM_MAX) {
@@ -86,27 +121,27 @@ Plot* plot_create(const uint8_t farmer_address[20], uint32_t k_param) {
     plot->entry_count = (uint64_t)1 << k_param;  // 2^k entries
     plot->is_sorted = false;
     
-    // Generate unique plot_id: BLAKE3(farmer_address || timestamp || k_param)
-    // This ensures each plot is unique even for same farmer
-    uint64_t ts = get_current_timestamp();
-    uint8_t buffer[20 + 8 + 4];
-    memcpy(buffer, farmer_address, 20);
-    memcpy(buffer + 20, &ts, 8);
-    memcpy(buffer + 28, &k_param, 4);
-    blake3_hash(buffer, sizeof(buffer), plot->plot_id);
+    plot_derive_id(farmer_address, k_param, plot->plot_id);
     
     // Calculate memory requirements
-    double mem_mb = (plot->entry_count * sizeof(PlotEntry)) / (1024.0 * 1024.0);
+    size_t entry_size = plot_compact_mode ? sizeof(PlotCompactEntry) : sizeof(PlotEntry);
+    double mem_mb = (plot->entry_count * entry_size) / (1024.0 * 1024.0);
     
     LOG_INFO("📁 ════════════════════════════════════════════════════════════");
     LOG_INFO("📁 PLOT ALLOCATION");
     LOG_INFO("   ├─ k parameter:  %u", k_param);
     LOG_INFO("   ├─ Entry count:  %lu (2^%u)", plot->entry_count, k_param);
     LOG_INFO("   ├─ Memory:       %.2f MB", mem_mb);
-    LOG_INFO("   └─ Entry size:   %lu bytes (4 nonce + 28 hash)", sizeof(PlotEntry));
+    if (plot_compact_mode)
+        LOG_INFO("   └─ Entry size:   %lu bytes (8 hash prefix + 4 nonce, compact)", entry_size);
+    else
+        LOG_INFO("   └─ Entry size:   %lu bytes (4 nonce + 28 hash)", entry_size);
     LOG_INFO("📁 ════════════════════════════════════════════════════════════");
     
-    plot->entries = safe_malloc(plot->entry_count * sizeof(PlotEntry));
+    if (plot_compact_mode)
+        plot->compact = safe_malloc(plot->entry_count * sizeof(PlotCompactEntry));
+    else
+        plot->entries = safe_malloc(plot->entry_count * sizeof(PlotEntry));
     
     return plot;
 }
@@ -128,17 +163,71 @@ Plot* plot_create(const uint8_t farmer_address[20], uint32_t k_param) {
 // TIME COMPLEXITY: O(2^k) - linear in number of entries
 // ============================================================================
 
+// BLAKE3(plot_id || nonce)[0:28] for n <= PLOT_HASH_BATCH nonces, one nonce
+// per SIMD lane. Shared by generation and compact-plot proof lookups.
+static void plot_hash_nonces(const uint8_t plot_id[32], const uint32_t* nonces, uint32_t n,
+                             uint8_t hashes[][28]) {
+    uint8_t buffers[PLOT_HASH_BATCH][36];
+    const uint8_t* inputs[PLOT_HASH_BATCH] = {0};
+    for (uint32_t j = 0; j < n; j++) {
+        memcpy(buffers[j], plot_id, 32);
+        memcpy(buffers[j] + 32, &nonces[j], 4);
+        inputs[j] = buffers[j];
+    }
+    blake3_hash_many(inputs, n, 36, hashes[0], 28);
+}
+
+// Entries for nonces first .. first + n - 1 (n <= PLOT_HASH_BATCH), one
+// nonce per SIMD lane, into entries[0..n) or, if entries is NULL, compact[0..n)
+static void plot_hash_batch(const uint8_t plot_id[32], uint64_t first, uint64_t n,
+                            PlotEntry* entries, PlotCompactEntry* compact) {
+    uint32_t nonces[PLOT_HASH_BATCH] = {0};
+    uint8_t hashes[PLOT_HASH_BATCH][28];
+    
+    for (uint64_t j = 0; j < n; j++) {
+        nonces[j] = (uint32_t)(first + j);
+    }
+    plot_hash_nonces(plot_id, nonces, (uint32_t)n, hashes);
+    if (entries) {
+        for (uint64_t j = 0; j < n; j++) {
+            entries[j].nonce = nonces[j];
+            memcpy(entries[j].hash, hashes[j], 28);
+        }
+    } else {
+        for (uint64_t j = 0; j < n; j++) {
+            memcpy(compact[j].prefix, hashes[j], PLOT_COMPACT_PREFIX);
+            compact[j].nonce = nonces[j];
+        }
+    }
+}
+
+// Worker threads for plot generation (0 = OpenMP default, one per core)
+static uint32_t plot_threads = 0;
+
+void plot_set_threads(uint32_t threads) {
+    plot_threads = threads;
+}
+
+uint32_t plot_get_threads(void) {
+    return plot_threads ? plot_threads : (uint32_t)omp_get_max_threads();
+}
+
 bool plot_generate(Plot* plot) {
-    if (!plot || !plot->entries) return false;
+    if (!plot || (!plot->entries && !plot->compact)) return false;
+    
+    uint32_t threads = plot_get_threads();
     
     LOG_INFO("⚙️  ════════════════════════════════════════════════════════════");
     LOG_INFO("⚙️  PLOT GENERATION STARTING (BLAKE3)");
     LOG_INFO("   ├─ Entries to generate: %lu", plot->entry_count);
-    LOG_INFO("   └─ Hash function: BLAKE3 (truncated to 28 bytes)");
+    LOG_INFO("   ├─ Threads:             %u", threads);
+    LOG_INFO("   └─ Hash function: BLAKE3 (truncated to 28 bytes, %s x%zu)",
+             blake3_simd_name(), blake3_simd_lanes());
     LOG_INFO("⚙️  ════════════════════════════════════════════════════════════");
     
     uint64_t start_time = get_current_time_ms();
     uint64_t last_progress = 0;
+    uint64_t generated = 0;     // Entries done, summed over all threads
     
     /*
      * PLOT ENTRY GENERATION ALGORITHM:
@@ -151,28 +240,51 @@ bool plot_generate(Plot* plot) {
      * 
      * The 28-byte truncation saves space while maintaining
      * enough entropy for collision resistance.
+     *
+     * Every entry depends only on its nonce, so the nonce space is cut
+     * into one contiguous range per thread. Within a range, nonces are
+     * hashed PLOT_HASH_BATCH at a time through blake3_hash_many(), one
+     * nonce per SIMD lane. Threads add to a shared counter every
+     * PLOT_PROGRESS_STEP entries and thread 0 reports the total.
      */
-    for (uint64_t i = 0; i < plot->entry_count; i++) {
-        plot->entries[i].nonce = (uint32_t)i;
-        
-        // Construct input: plot_id (32 bytes) || nonce (4 bytes)
-        uint8_t buffer[36];
-        memcpy(buffer, plot->plot_id, 32);
-        uint32_t nonce = (uint32_t)i;
-        memcpy(buffer + 32, &nonce, 4);
-        
-        // BLAKE3 hash truncated to 28 bytes
-        blake3_hash_truncated(buffer, sizeof(buffer), plot->entries[i].hash, 28);
+    #pragma omp parallel num_threads(threads)
+    {
+        uint64_t nth = (uint64_t)omp_get_num_threads();
+        uint64_t tid = (uint64_t)omp_get_thread_num();
+        uint64_t lo = plot->entry_count * tid / nth;
+        uint64_t hi = plot->entry_count * (tid + 1) / nth;
         
-        // Progress logging every 10%
-        uint64_t progress = (i * 100) / plot->entry_count;
-        if (progress >= last_progress + 10) {
-            uint64_t elapsed = get_current_time_ms() - start_time;
-            double rate = (double)i / (elapsed / 1000.0);
-            LOG_INFO("   📊 Progress: %lu%% (%lu entries, %.0f entries/sec)", 
-                     progress, i, rate);
-            last_progress = progress;
+        uint64_t unreported = 0;
+        for (uint64_t i = lo; i < hi; i += PLOT_HASH_BATCH) {
+            uint64_t n = hi - i;
+            if (n > PLOT_HASH_BATCH) n = PLOT_HASH_BATCH;
+            
+            plot_hash_batch(plot->plot_id, i, n,
+                            plot->entries ? plot->entries + i : NULL,
+                            plot->compact ? plot->compact + i : NULL);
+            
+            unreported += n;
+            if (unreported < PLOT_PROGRESS_STEP) continue;
+            #pragma omp atomic
+            generated += unreported;
+            unreported = 0;
+            
+            // Progress logging every 10%
+            if (tid != 0) continue;
+            uint64_t done;
+            #pragma omp atomic read
+            done = generated;
+            uint64_t progress = (done * 100) / plot->entry_count;
+            if (progress >= last_progress + 10) {
+                uint64_t elapsed = get_current_time_ms() - start_time;
+                double rate = (double)done / (elapsed / 1000.0);
+                LOG_INFO("   📊 Progress: %lu%% (%lu entries, %.0f entries/sec)", 
+                         progress, done, rate);
+                last_progress = progress;
+            }
         }
+        #pragma omp atomic
+        generated += unreported;
     }
     
     uint64_t gen_time = get_current_time_ms() - start_time;
@@ -208,49 +320,280 @@ int plot_entry_compare(const void* a, const void* b) {
     return memcmp(ea->hash, eb->hash, 28);
 }
 
+/*
+ * RADIX SORT:
+ * ===========
+ * BLAKE3 outputs are uniform, so the leading hash bytes split the entries
+ * into evenly sized buckets. Byte 0 is distributed in parallel: every
+ * thread counts its slice, the counts are turned into per-thread write
+ * offsets, and every thread scatters its slice into a scratch array.
+ * The 256 buckets are then sorted independently across threads, one byte
+ * per level (counting sort between the two arrays), until a bucket is
+ * small enough for insertion sort on the remaining bytes.
+ *
+ * Two 8-bit levels leave ~2^(k-16) entries per bucket, so k=28 reaches
+ * insertion sort after three passes. The scratch array is as large as
+ * the plot; if it cannot be allocated, qsort is used instead.
+ */
+
+// The same sort serves full entries (keyed by hash[28]) and compact ones
+// (keyed by prefix[8]); the macro defines NAME_insertion_sort,
+// NAME_radix_sort_range and NAME_radix_sort for one entry type.
+#define PLOT_DEFINE_RADIX_SORT(NAME, TYPE, KEY, KEY_LEN)                                 \
+                                                                                         \
+/* Insertion sort on entries whose first `byte` key bytes are equal */                  \
+static void NAME##_insertion_sort(TYPE* e, size_t n, unsigned byte) {                    \
+    for (size_t i = 1; i < n; i++) {                                                     \
+        TYPE key = e[i];                                                                 \
+        size_t j = i;                                                                    \
+        while (j > 0 && memcmp(e[j - 1].KEY + byte, key.KEY + byte, KEY_LEN - byte) > 0) { \
+            e[j] = e[j - 1];                                                             \
+            j--;                                                                         \
+        }                                                                                \
+        e[j] = key;                                                                      \
+    }                                                                                    \
+}                                                                                        \
+                                                                                         \
+/* Sort data[0..n), whose first `byte` key bytes are equal, using scratch               \
+ * as the other half of each counting pass. The result ends up in scratch               \
+ * if to_scratch, otherwise in data. */                                                  \
+static void NAME##_radix_sort_range(TYPE* data, TYPE* scratch, size_t n,                 \
+                                    unsigned byte, bool to_scratch) {                    \
+    if (n <= PLOT_SORT_SMALL || byte >= KEY_LEN) {                                       \
+        NAME##_insertion_sort(data, n, byte);                                            \
+        if (to_scratch) memcpy(scratch, data, n * sizeof(TYPE));                         \
+        return;                                                                          \
+    }                                                                                    \
+                                                                                         \
+    size_t count[256] = {0};                                                             \
+    for (size_t i = 0; i < n; i++) count[data[i].KEY[byte]]++;                           \
+                                                                                         \
+    size_t offset[256];                                                                  \
+    size_t sum = 0;                                                                      \
+    for (int d = 0; d < 256; d++) {                                                      \
+        offset[d] = sum;                                                                 \
+        sum += count[d];                                                                 \
+    }                                                                                    \
+    for (size_t i = 0; i < n; i++) scratch[offset[data[i].KEY[byte]]++] = data[i];       \
+                                                                                         \
+    /* The buckets now live in scratch; each one lands where the caller wants */         \
+    size_t start = 0;                                                                    \
+    for (int d = 0; d < 256; d++) {                                                      \
+        if (count[d] > 0)                                                                \
+            NAME##_radix_sort_range(scratch + start, data + start, count[d], byte + 1,   \
+                                    !to_scratch);                                        \
+        start += count[d];                                                               \
+    }                                                                                    \
+}                                                                                        \
+                                                                                         \
+static bool NAME##_radix_sort(TYPE* entries, uint64_t n, uint32_t threads) {             \
+    TYPE* scratch = malloc(n * sizeof(TYPE));                                            \
+    if (!scratch) return false;                                                          \
+                                                                                         \
+    /* hist[t * 256 + d]: entries with first byte d in thread t's slice,                 \
+     * turned into thread t's write offset for bucket d */                               \
+    uint64_t* hist = safe_malloc((size_t)threads * 256 * sizeof(uint64_t));              \
+    memset(hist, 0, (size_t)threads * 256 * sizeof(uint64_t));                           \
+    uint64_t bucket_start[257];                                                          \
+                                                                                         \
+    _Pragma("omp parallel num_threads(threads)")                                         \
+    {                                                                                    \
+        uint64_t nth = (uint64_t)omp_get_num_threads();                                  \
+        uint64_t tid = (uint64_t)omp_get_thread_num();                                   \
+        uint64_t lo = n * tid / nth;                                                     \
+        uint64_t hi = n * (tid + 1) / nth;                                               \
+        uint64_t* h = hist + tid * 256;                                                  \
+                                                                                         \
+        for (uint64_t i = lo; i < hi; i++) h[entries[i].KEY[0]]++;                       \
+        _Pragma("omp barrier")                                                           \
+                                                                                         \
+        _Pragma("omp single")                                                            \
+        {                                                                                \
+            uint64_t sum = 0;                                                            \
+            for (int d = 0; d < 256; d++) {                                              \
+                bucket_start[d] = sum;                                                   \
+                for (uint64_t t = 0; t < nth; t++) {                                     \
+                    uint64_t c = hist[t * 256 + d];                                      \
+                    hist[t * 256 + d] = sum;                                             \
+                    sum += c;                                                            \
+                }                                                                        \
+            }                                                                            \
+            bucket_start[256] = sum;                                                     \
+        }                                                                                \
+                                                                                         \
+        for (uint64_t i = lo; i < hi; i++) scratch[h[entries[i].KEY[0]]++] = entries[i]; \
+        _Pragma("omp barrier")                                                           \
+                                                                                         \
+        /* Buckets are even for uniform hashes; dynamic covers the rest */               \
+        _Pragma("omp for schedule(dynamic, 1)")                                          \
+        for (int d = 0; d < 256; d++) {                                                  \
+            uint64_t b = bucket_start[d];                                                \
+            NAME##_radix_sort_range(scratch + b, entries + b, bucket_start[d + 1] - b,   \
+                                    1, true);                                            \
+        }                                                                                \
+    }                                                                                    \
+                                                                                         \
+    free(hist);                                                                          \
+    free(scratch);                                                                       \
+    return true;                                                                         \
+}
+
+PLOT_DEFINE_RADIX_SORT(plot, PlotEntry, hash, 28)
+PLOT_DEFINE_RADIX_SORT(plot_compact, PlotCompactEntry, prefix, PLOT_COMPACT_PREFIX)
+
+static int plot_compact_entry_compare(const void* a, const void* b) {
+    const PlotCompactEntry* ea = (const PlotCompactEntry*)a;
+    const PlotCompactEntry* eb = (const PlotCompactEntry*)b;
+    return memcmp(ea->prefix, eb->prefix, PLOT_COMPACT_PREFIX);
+}
+
 void plot_sort(Plot* plot) {
-    if (!plot || !plot->entries || plot->is_sorted) return;
+    if (!plot || (!plot->entries && !plot->compact) || plot->is_sorted) return;
     
-    LOG_INFO("🔀 Sorting %lu plot entries by hash...", plot->entry_count);
+    uint32_t threads = plot_get_threads();
+    LOG_INFO("🔀 Sorting %lu plot entries by hash (radix, %u threads)...",
+             plot->entry_count, threads);
     uint64_t start_time = get_current_time_ms();
     
-    // Standard quicksort - O(n log n) average case
-    qsort(plot->entries, plot->entry_count, sizeof(PlotEntry), plot_entry_compare);
+    if (plot->compact) {
+        if (!plot_compact_radix_sort(plot->compact, plot->entry_count, threads)) {
+            LOG_WARN("🔀 No memory for radix sort scratch (%lu MB), using qsort",
+                     plot->entry_count * sizeof(PlotCompactEntry) / (1024 * 1024));
+            qsort(plot->compact, plot->entry_count, sizeof(PlotCompactEntry),
+                  plot_compact_entry_compare);
+        }
+    } else if (!plot_radix_sort(plot->entries, plot->entry_count, threads)) {
+        LOG_WARN("🔀 No memory for radix sort scratch (%lu MB), using qsort",
+                 plot->entry_count * sizeof(PlotEntry) / (1024 * 1024));
+        qsort(plot->entries, plot->entry_count, sizeof(PlotEntry), plot_entry_compare);
+    }
     
     plot->is_sorted = true;
+    plot_build_index(plot);
     
     uint64_t sort_time = get_current_time_ms() - start_time;
-    LOG_INFO("🔀 Sorting complete in %lu ms", sort_time);
+    LOG_INFO("🔀 Sorting complete in %lu ms (prefix index: %u bits)", sort_time,
+             plot->index_bits);
     LOG_INFO("✅ Plot ready for challenges!");
 }
 
+// ============================================================================
+// PREFIX INDEX
+// ============================================================================
+//
+// index[p] = position of the first entry whose top index_bits hash bits
+// are >= p, for p = 0 .. 2^index_bits (index[2^bits] = entry_count).
+// Entries with prefix p are [index[p], index[p+1]), so a lookup reads one
+// pair of offsets and binary-searches a bucket of ~PLOT_INDEX_BUCKET
+// entries instead of probing log2(n) cache lines across the whole plot.
+//
+// Bits are picked so buckets average PLOT_INDEX_BUCKET entries, within
+// PLOT_INDEX_MIN_BITS..PLOT_INDEX_MAX_BITS: 4 bytes per 8 entries, ~1.6%
+// of the plot, capped at 64 MB for k >= 27.
+// ============================================================================
+
+// Sort key of entry i: its hash, or its hash prefix in a compact plot
+static inline const uint8_t* plot_key(const Plot* plot, uint64_t i) {
+    return plot->compact ? plot->compact[i].prefix : plot->entries[i].hash;
+}
+
+static inline size_t plot_key_len(const Plot* plot) {
+    return plot->compact ? PLOT_COMPACT_PREFIX : 28;
+}
+
+static inline uint32_t plot_hash_prefix(const uint8_t* hash, uint32_t bits) {
+    uint32_t top = ((uint32_t)hash[0] << 24) | ((uint32_t)hash[1] << 16) |
+                   ((uint32_t)hash[2] << 8) | (uint32_t)hash[3];
+    return top >> (32 - bits);
+}
+
+static uint32_t plot_index_bits_for(uint64_t entry_count) {
+    uint32_t bits = PLOT_INDEX_MIN_BITS;
+    while (bits < PLOT_INDEX_MAX_BITS && ((uint64_t)PLOT_INDEX_BUCKET << (bits + 1)) <= entry_count)
+        bits++;
+    return bits;
+}
+
+static void plot_free_index(Plot* plot) {
+    if (!plot->index_mapped) free(plot->index);
+    plot->index = NULL;
+    plot->index_bits = 0;
+    plot->index_mapped = false;
+}
+
+void plot_build_index(Plot* plot) {
+    if (!plot || (!plot->entries && !plot->compact) || !plot->is_sorted) return;
+    plot_free_index(plot);
+
+    uint32_t bits = plot_index_bits_for(plot->entry_count);
+    uint64_t slots = (uint64_t)1 << bits;
+    uint64_t n = plot->entry_count;
+    uint32_t* index = safe_malloc((slots + 1) * sizeof(uint32_t));
+
+    // Entry i owns the slots (prefix(i-1), prefix(i)]; every slot is
+    // written exactly once, so the entries can be split across threads
+    #pragma omp parallel for schedule(static) num_threads(plot_get_threads())
+    for (uint64_t i = 0; i <= n; i++) {
+        uint64_t from = i == 0 ? 0 : (uint64_t)plot_hash_prefix(plot_key(plot, i - 1), bits) + 1;
+        uint64_t to = i == n ? slots : plot_hash_prefix(plot_key(plot, i), bits);
+        for (uint64_t p = from; p <= to; p++) index[p] = (uint32_t)i;
+    }
+
+    plot->index = index;
+    plot->index_bits = bits;
+}
+
 // ============================================================================
 // PLOT PERSISTENCE (binary format)
 // ============================================================================
 // File layout (little-endian):
 //   [8]  magic = "QMEMPLOT"
-//   [1]  version = 1
+//   [1]  version = 2
 //   [4]  k_param
 //   [8]  entry_count
 //   [1]  is_sorted
 //   [32] plot_id
 //   [20] farmer_address
-//   [entry_count * 32]  entries (PlotEntry array)
+//   [1]  index_bits (0 = no prefix index stored)
+//   [8]  index_offset
+//   [1]  entry_size (32 = PlotEntry, 12 = PlotCompactEntry; 0 reads as 32)
+//   zero padding up to PLOT_FILE_DATA_OFFSET (one page)
+//   [entry_count * entry_size]  entries (PlotEntry or PlotCompactEntry array)
+//   zero padding up to the next page
+//   [(2^index_bits + 1) * 4]  prefix index (see PREFIX INDEX)
+//
+// Version 1 files have the same header with the entries right after it.
+// They are still read, into the heap.
+//
+// Version 2 entries start on a page boundary so a sorted plot is used in
+// place: plot_load_from_file() maps the file read-only and points entries
+// into the mapping. Nothing is read up front, so loading takes
+// milliseconds at any k, and validators on one host share the plot's
+// pages through the page cache. A stored prefix index is mapped with the
+// entries; plots without one (older files) get it rebuilt on load.
+// Saves go to a temp file that is renamed
+// over the old plot, so a mapping held by a running validator stays valid.
 // ============================================================================
 
 #define PLOT_FILE_MAGIC "QMEMPLOT"
-#define PLOT_FILE_VERSION 1
+#define PLOT_FILE_VERSION 2
+#define PLOT_FILE_HEADER_V1 74           // Entry offset in version 1 files
+#define PLOT_FILE_HEADER_V2 84           // Version 1 header + index_bits + index_offset + entry_size
+#define PLOT_FILE_DATA_OFFSET 4096       // Entry offset in version 2 files
 
-bool plot_save_to_file(const Plot* plot, const char* path) {
-    if (!plot || !plot->entries || !path) return false;
-    FILE* f = fopen(path, "wb");
-    if (!f) {
-        LOG_ERROR("plot_save_to_file: cannot open %s for write", path);
-        return false;
-    }
-    bool ok = true;
+static uint32_t plot_load_mode = PLOT_LOAD_MMAP;
+static const uint8_t plot_zero_page[PLOT_FILE_DATA_OFFSET];
+
+void plot_set_load_mode(uint32_t mode) {
+    plot_load_mode = mode;
+}
+
+// Version 2 header, zero-padded to PLOT_FILE_DATA_OFFSET
+static bool plot_write_header(FILE* f, const Plot* plot, uint8_t entry_size,
+                              uint8_t index_bits, uint64_t index_offset) {
     uint8_t version = PLOT_FILE_VERSION;
     uint8_t sorted = plot->is_sorted ? 1 : 0;
+    bool ok = true;
     ok = ok && fwrite(PLOT_FILE_MAGIC, 8, 1, f) == 1;
     ok = ok && fwrite(&version, 1, 1, f) == 1;
     ok = ok && fwrite(&plot->k_param, sizeof(plot->k_param), 1, f) == 1;
@@ -258,54 +601,534 @@ bool plot_save_to_file(const Plot* plot, const char* path) {
     ok = ok && fwrite(&sorted, 1, 1, f) == 1;
     ok = ok && fwrite(plot->plot_id, 32, 1, f) == 1;
     ok = ok && fwrite(plot->farmer_address, 20, 1, f) == 1;
-    ok = ok && fwrite(plot->entries, sizeof(PlotEntry), plot->entry_count, f) == plot->entry_count;
+    ok = ok && fwrite(&index_bits, 1, 1, f) == 1;
+    ok = ok && fwrite(&index_offset, sizeof(index_offset), 1, f) == 1;
+    ok = ok && fwrite(&entry_size, 1, 1, f) == 1;
+    ok = ok && fwrite(plot_zero_page, PLOT_FILE_DATA_OFFSET - PLOT_FILE_HEADER_V2, 1, f) == 1;
+    return ok;
+}
+
+// Page-aligned offset of the prefix index that follows data_end
+static uint64_t plot_index_offset(uint64_t data_end) {
+    return (data_end + PLOT_FILE_DATA_OFFSET - 1) / PLOT_FILE_DATA_OFFSET * PLOT_FILE_DATA_OFFSET;
+}
+
+bool plot_save_to_file(const Plot* plot, const char* path) {
+    if (!plot || (!plot->entries && !plot->compact) || !path) return false;
+    char tmp_path[512];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    FILE* f = fopen(tmp_path, "wb");
+    if (!f) {
+        LOG_ERROR("plot_save_to_file: cannot open %s for write", tmp_path);
+        return false;
+    }
+    uint8_t index_bits = plot->index ? (uint8_t)plot->index_bits : 0;
+    uint8_t entry_size = plot->compact ? sizeof(PlotCompactEntry) : sizeof(PlotEntry);
+    const void* entries = plot->compact ? (const void*)plot->compact : (const void*)plot->entries;
+    uint64_t data_end = PLOT_FILE_DATA_OFFSET + plot->entry_count * entry_size;
+    uint64_t index_offset = index_bits ? plot_index_offset(data_end) : 0;
+    bool ok = plot_write_header(f, plot, entry_size, index_bits, index_offset);
+    ok = ok && fwrite(entries, entry_size, plot->entry_count, f) == plot->entry_count;
+    if (index_bits) {
+        size_t slots = ((size_t)1 << index_bits) + 1;
+        ok = ok && (index_offset == data_end ||
+                    fwrite(plot_zero_page, index_offset - data_end, 1, f) == 1);
+        ok = ok && fwrite(plot->index, sizeof(uint32_t), slots, f) == slots;
+    }
+    ok = (fflush(f) == 0) && ok;
+    ok = ok && fsync(fileno(f)) == 0;
     fclose(f);
-    if (!ok) {
+    if (!ok || rename(tmp_path, path) != 0) {
         LOG_ERROR("plot_save_to_file: short write to %s", path);
+        unlink(tmp_path);
         return false;
     }
     return true;
 }
 
+static bool plot_read_full(int fd, void* buf, size_t len, off_t offset) {
+    uint8_t* p = buf;
+    while (len > 0) {
+        ssize_t n = pread(fd, p, len, offset);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        len -= (size_t)n;
+        offset += n;
+    }
+    return true;
+}
+
 Plot* plot_load_from_file(const char* path) {
     if (!path) return NULL;
-    FILE* f = fopen(path, "rb");
-    if (!f) return NULL;
-    char magic[8];
-    uint8_t version, sorted;
-    if (fread(magic, 8, 1, f) != 1 || memcmp(magic, PLOT_FILE_MAGIC, 8) != 0) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    
+    uint64_t start_time = get_current_time_ms();
+    uint8_t header[PLOT_FILE_HEADER_V2] = {0};
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !plot_read_full(fd, header, PLOT_FILE_HEADER_V1, 0) ||
+        memcmp(header, PLOT_FILE_MAGIC, 8) != 0) {
         LOG_ERROR("plot_load_from_file: bad magic in %s", path);
-        fclose(f); return NULL;
+        close(fd); return NULL;
     }
-    if (fread(&version, 1, 1, f) != 1 || version != PLOT_FILE_VERSION) {
+    uint8_t version = header[8];
+    if (version != 1 && version != PLOT_FILE_VERSION) {
         LOG_ERROR("plot_load_from_file: bad version in %s", path);
-        fclose(f); return NULL;
+        close(fd); return NULL;
     }
+    
     Plot* plot = (Plot*)safe_malloc(sizeof(Plot));
     memset(plot, 0, sizeof(Plot));
-    if (fread(&plot->k_param, sizeof(plot->k_param), 1, f) != 1) goto fail;
-    if (fread(&plot->entry_count, sizeof(plot->entry_count), 1, f) != 1) goto fail;
-    if (fread(&sorted, 1, 1, f) != 1) goto fail;
-    plot->is_sorted = (sorted != 0);
-    if (fread(plot->plot_id, 32, 1, f) != 1) goto fail;
-    if (fread(plot->farmer_address, 20, 1, f) != 1) goto fail;
+    memcpy(&plot->k_param, header + 9, 4);
+    memcpy(&plot->entry_count, header + 13, 8);
+    plot->is_sorted = header[21] != 0;
+    memcpy(plot->plot_id, header + 22, 32);
+    memcpy(plot->farmer_address, header + 54, 20);
+    
+    size_t data_offset = version == 1 ? PLOT_FILE_HEADER_V1 : PLOT_FILE_DATA_OFFSET;
     if (plot->entry_count == 0 || plot->entry_count > ((uint64_t)1 << K_PARAM_MAX)) goto fail;
-    plot->entries = (PlotEntry*)safe_malloc(sizeof(PlotEntry) * plot->entry_count);
-    if (fread(plot->entries, sizeof(PlotEntry), plot->entry_count, f) != plot->entry_count) {
-        free(plot->entries);
-        goto fail;
+    
+    // Version 2 header tail: prefix index location and entry size
+    uint8_t index_bits = 0;
+    uint64_t index_offset = 0;
+    size_t entry_size = sizeof(PlotEntry);
+    if (version == PLOT_FILE_VERSION) {
+        if (!plot_read_full(fd, header + PLOT_FILE_HEADER_V1,
+                            PLOT_FILE_HEADER_V2 - PLOT_FILE_HEADER_V1, PLOT_FILE_HEADER_V1))
+            goto fail;
+        index_bits = header[74];
+        memcpy(&index_offset, header + 75, 8);
+        if (header[83] != 0) entry_size = header[83];
     }
-    fclose(f);
-    LOG_INFO("✅ plot_load_from_file: loaded %lu entries (k=%u, sorted=%d) from %s",
-             plot->entry_count, plot->k_param, plot->is_sorted, path);
+    if (entry_size != sizeof(PlotEntry) && entry_size != sizeof(PlotCompactEntry)) {
+        LOG_ERROR("plot_load_from_file: bad entry size %zu in %s", entry_size, path);
+        free(plot);
+        close(fd);
+        return NULL;
+    }
+    bool compact = entry_size == sizeof(PlotCompactEntry);
+    size_t data_len = plot->entry_count * entry_size;
+    if ((uint64_t)st.st_size < data_offset + data_len) goto fail;
+    
+    // Stored prefix index: used only if it is the expected size and in the file
+    size_t index_len = 0;
+    if (index_bits && plot->is_sorted && index_bits == plot_index_bits_for(plot->entry_count)) {
+        index_len = (((size_t)1 << index_bits) + 1) * sizeof(uint32_t);
+        if (index_offset < data_offset + data_len || (uint64_t)st.st_size < index_offset + index_len)
+            index_len = 0;
+    }
+    if (!index_len) index_bits = 0;
+    
+    // Version 2, sorted: use the file in place. An unsorted plot still has
+    // to be sorted in memory, so it is read like a version 1 file.
+    const char* how = "read";
+    if (version == PLOT_FILE_VERSION && plot->is_sorted && plot_load_mode != PLOT_LOAD_HEAP) {
+        int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+        if (plot_load_mode == PLOT_LOAD_POPULATE) flags |= MAP_POPULATE;
+#endif
+        size_t map_length = index_bits ? index_offset + index_len : data_offset + data_len;
+        void* base = mmap(NULL, map_length, PROT_READ, flags, fd, 0);
+        if (base == MAP_FAILED) {
+            LOG_WARN("plot_load_from_file: mmap %s failed (%s), reading instead",
+                     path, strerror(errno));
+        } else {
+            if (plot_load_mode == PLOT_LOAD_RANDOM)
+                madvise(base, map_length, MADV_RANDOM);
+            plot->map_base = base;
+            plot->map_length = map_length;
+            if (compact) plot->compact = (PlotCompactEntry*)((uint8_t*)base + data_offset);
+            else         plot->entries = (PlotEntry*)((uint8_t*)base + data_offset);
+            if (index_bits) {
+                plot->index = (uint32_t*)((uint8_t*)base + index_offset);
+                plot->index_bits = index_bits;
+                plot->index_mapped = true;
+            }
+            how = plot_load_mode == PLOT_LOAD_POPULATE ? "mapped+populated"
+                : plot_load_mode == PLOT_LOAD_RANDOM ? "mapped (random access)" : "mapped";
+        }
+    }
+    if (!plot->map_base) {
+        void* data = safe_malloc(data_len);
+        if (!plot_read_full(fd, data, data_len, (off_t)data_offset)) {
+            free(data);
+            goto fail;
+        }
+        if (compact) plot->compact = data;
+        else         plot->entries = data;
+        if (index_bits) {
+            plot->index = safe_malloc(index_len);
+            plot->index_bits = index_bits;
+            if (!plot_read_full(fd, plot->index, index_len, (off_t)index_offset))
+                plot_free_index(plot);
+        }
+    }
+    close(fd);
+    
+    // Cheap sanity check of a stored index; anything else gets a fresh one
+    if (plot->index && (plot->index[0] != 0 ||
+                        plot->index[(size_t)1 << plot->index_bits] != plot->entry_count))
+        plot_free_index(plot);
+    if (!plot->index) plot_build_index(plot);
+    LOG_INFO("✅ plot_load_from_file: %s %lu %sentries (k=%u, sorted=%d, v%u) from %s in %lu ms",
+             how, plot->entry_count, compact ? "compact " : "", plot->k_param,
+             plot->is_sorted, version, path,
+             get_current_time_ms() - start_time);
     return plot;
 fail:
     free(plot);
-    fclose(f);
+    close(fd);
     LOG_ERROR("plot_load_from_file: short read from %s", path);
     return NULL;
 }
 
+// ============================================================================
+// STREAMING PLOT GENERATION (plots larger than RAM)
+// ============================================================================
+//
+// plot_create() + plot_generate() hold the whole plot in memory, plus a
+// same-sized scratch array while sorting. plot_generate_to_file() writes
+// the file plot_save_to_file() would, within a memory budget:
+//
+//   1. RUNS:  the nonces are cut into runs that fit the budget together
+//             with their sort scratch. Each run is hashed and radix-sorted
+//             like a small plot and spilled to an unlinked temp file.
+//   2. MERGE: a min-heap over the runs streams the entries in hash order
+//             straight into the plot file after the header. The prefix
+//             index is filled in as entries go by and appended at the end.
+//
+// Disk traffic is one write and one read of every run plus the plot
+// itself. With a 4 GB budget a k=30 plot (32 GB) is 16 runs of 2^26
+// entries. A plot that fits in one run skips the spill. Each stage's
+// time and throughput are logged.
+// ============================================================================
+
+static uint64_t plot_memory_limit = 0;
+
+void plot_set_memory_limit(uint64_t bytes) {
+    plot_memory_limit = bytes;
+}
+
+uint64_t plot_get_memory_limit(void) {
+    return plot_memory_limit;
+}
+
+typedef struct {
+    FILE* f;            // Spilled run (NULL = whole run is in buf)
+    uint8_t* buf;
+    size_t cap;         // Records buf holds
+    size_t len;         // Records in buf
+    size_t pos;         // Next record in buf
+    uint64_t left;      // Records not yet read from f
+    bool error;
+} PlotRun;
+
+// Make sure run r has a current record; false once it is exhausted
+static bool plot_run_fill(PlotRun* r, size_t entry_size) {
+    if (r->pos < r->len) return true;
+    if (!r->f || r->left == 0) return false;
+    size_t n = r->left < r->cap ? (size_t)r->left : r->cap;
+    if (fread(r->buf, entry_size, n, r->f) != n) {
+        r->error = true;
+        return false;
+    }
+    r->len = n;
+    r->pos = 0;
+    r->left -= n;
+    return true;
+}
+
+typedef struct {
+    PlotRun* runs;
+    uint32_t* heap;     // Run numbers, smallest current key first
+    uint32_t size;
+    size_t entry_size;
+    size_t key_offset;
+    size_t key_len;
+} PlotMerge;
+
+static inline const uint8_t* plot_merge_key(const PlotMerge* m, uint32_t r) {
+    const PlotRun* run = &m->runs[r];
+    return run->buf + run->pos * m->entry_size + m->key_offset;
+}
+
+static inline bool plot_merge_less(const PlotMerge* m, uint32_t a, uint32_t b) {
+    int c = memcmp(plot_merge_key(m, a), plot_merge_key(m, b), m->key_len);
+    return c < 0 || (c == 0 && a < b);
+}
+
+static void plot_merge_sift_down(PlotMerge* m, uint32_t i) {
+    for (;;) {
+        uint32_t least = i;
+        uint32_t l = 2 * i + 1, r = 2 * i + 2;
+        if (l < m->size && plot_merge_less(m, m->heap[l], m->heap[least])) least = l;
+        if (r < m->size && plot_merge_less(m, m->heap[r], m->heap[least])) least = r;
+        if (least == i) return;
+        uint32_t t = m->heap[i];
+        m->heap[i] = m->heap[least];
+        m->heap[least] = t;
+        i = least;
+    }
+}
+
+static double plot_rate(uint64_t count, uint64_t ms) {
+    return ms > 0 ? count * 1000.0 / ms : 0.0;
+}
+
+bool plot_generate_to_file(const uint8_t farmer_address[20], uint32_t k_param,
+                           const char* path) {
+    if (!farmer_address || !path) return false;
+    if (k_param < K_PARAM_MIN || k_param > K_PARAM_MAX) {
+        LOG_ERROR("❌ Invalid k parameter: %u (must be %d-%d)", k_param, K_PARAM_MIN, K_PARAM_MAX);
+        return false;
+    }
+    
+    // Header-only plot: everything the file header records
+    Plot header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.farmer_address, farmer_address, 20);
+    header.k_param = k_param;
+    header.entry_count = (uint64_t)1 << k_param;
+    header.is_sorted = true;
+    plot_derive_id(farmer_address, k_param, header.plot_id);
+    
+    bool compact = plot_compact_mode;
+    size_t entry_size = compact ? sizeof(PlotCompactEntry) : sizeof(PlotEntry);
+    size_t key_offset = compact ? offsetof(PlotCompactEntry, prefix) : offsetof(PlotEntry, hash);
+    size_t key_len = compact ? PLOT_COMPACT_PREFIX : 28;
+    uint64_t n = header.entry_count;
+    uint32_t threads = plot_get_threads();
+    
+    // A run and its radix sort scratch share the budget
+    uint64_t budget = plot_memory_limit ? plot_memory_limit : PLOT_STREAM_MEMORY_DEFAULT;
+    uint64_t run_entries = budget / (2 * entry_size) / PLOT_HASH_BATCH * PLOT_HASH_BATCH;
+    if (run_entries > n) run_entries = n;
+    if (run_entries < PLOT_HASH_BATCH || (n + run_entries - 1) / run_entries > PLOT_STREAM_MAX_RUNS) {
+        LOG_ERROR("❌ Plot memory limit of %lu MB is too small for k=%u (over %d runs)",
+                  budget >> 20, k_param, PLOT_STREAM_MAX_RUNS);
+        return false;
+    }
+    uint32_t run_count = (uint32_t)((n + run_entries - 1) / run_entries);
+    
+    LOG_INFO("⚙️  ════════════════════════════════════════════════════════════");
+    LOG_INFO("⚙️  STREAMING PLOT GENERATION");
+    LOG_INFO("   ├─ Entries:       %lu (2^%u, %lu MB%s)", n, k_param,
+             (n * entry_size) >> 20, compact ? ", compact" : "");
+    LOG_INFO("   ├─ Memory limit:  %lu MB", budget >> 20);
+    LOG_INFO("   ├─ Runs:          %u x %lu entries", run_count, run_entries);
+    LOG_INFO("   ├─ Threads:       %u", threads);
+    LOG_INFO("   └─ Output:        %s", path);
+    LOG_INFO("⚙️  ════════════════════════════════════════════════════════════");
+    
+    bool ok = false;
+    uint64_t start_time = get_current_time_ms();
+    PlotRun* runs = safe_malloc(run_count * sizeof(PlotRun));
+    memset(runs, 0, run_count * sizeof(PlotRun));
+    uint32_t* heap = NULL;
+    uint32_t* index = NULL;
+    uint8_t* out_buf = NULL;
+    FILE* out = NULL;
+    char tmp_path[512];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    
+    uint8_t* buf = malloc(run_entries * entry_size);
+    if (!buf) {
+        LOG_ERROR("❌ Cannot allocate %lu MB for a plot run", (run_entries * entry_size) >> 20);
+        goto done;
+    }
+    
+    /*
+     * STAGE 1: Sorted runs
+     * ====================
+     * Nonces [r * run_entries, (r + 1) * run_entries) are hashed in
+     * parallel and radix-sorted in place. With more than one run the
+     * result is spilled to a temp file that is unlinked as soon as it
+     * is created, so it disappears with the process on any exit.
+     */
+    uint64_t hash_ms = 0, sort_ms = 0, spill_ms = 0;
+    for (uint32_t r = 0; r < run_count; r++) {
+        uint64_t lo = (uint64_t)r * run_entries;
+        uint64_t count = n - lo < run_entries ? n - lo : run_entries;
+        uint64_t batches = (count + PLOT_HASH_BATCH - 1) / PLOT_HASH_BATCH;
+        
+        uint64_t t0 = get_current_time_ms();
+        #pragma omp parallel for schedule(static) num_threads(threads)
+        for (uint64_t b = 0; b < batches; b++) {
+            uint64_t first = b * PLOT_HASH_BATCH;
+            uint64_t m = count - first < PLOT_HASH_BATCH ? count - first : PLOT_HASH_BATCH;
+            plot_hash_batch(header.plot_id, lo + first, m,
+                            compact ? NULL : (PlotEntry*)buf + first,
+                            compact ? (PlotCompactEntry*)buf + first : NULL);
+        }
+        
+        uint64_t t1 = get_current_time_ms();
+        bool sorted = compact ? plot_compact_radix_sort((PlotCompactEntry*)buf, count, threads)
+                              : plot_radix_sort((PlotEntry*)buf, count, threads);
+        if (!sorted)
+            qsort(buf, count, entry_size, compact ? plot_compact_entry_compare : plot_entry_compare);
+        
+        uint64_t t2 = get_current_time_ms();
+        if (run_count == 1) {
+            runs[0].buf = buf;
+            runs[0].cap = runs[0].len = count;
+            buf = NULL;
+        } else {
+            char run_path[512];
+            snprintf(run_path, sizeof(run_path), "%s.run%u", path, r);
+            runs[r].f = fopen(run_path, "w+b");
+            if (!runs[r].f) {
+                LOG_ERROR("❌ Cannot create plot run %s: %s", run_path, strerror(errno));
+                goto done;
+            }
+            unlink(run_path);
+            runs[r].left = count;
+            if (fwrite(buf, entry_size, count, runs[r].f) != count || fflush(runs[r].f) != 0) {
+                LOG_ERROR("❌ Short write to plot run %s", run_path);
+                goto done;
+            }
+        }
+        uint64_t t3 = get_current_time_ms();
+        
+        hash_ms += t1 - t0;
+        sort_ms += t2 - t1;
+        spill_ms += t3 - t2;
+        LOG_INFO("   📊 Run %u/%u: %lu entries (hash %lu ms, sort %lu ms, spill %lu ms)",
+                 r + 1, run_count, count, t1 - t0, t2 - t1, t3 - t2);
+    }
+    free(buf);
+    buf = NULL;
+    
+    LOG_INFO("⚙️  Runs complete in %lu ms", get_current_time_ms() - start_time);
+    LOG_INFO("   ├─ Hash:   %.0f entries/sec", plot_rate(n, hash_ms));
+    LOG_INFO("   ├─ Sort:   %.0f entries/sec", plot_rate(n, sort_ms));
+    if (run_count > 1)
+        LOG_INFO("   └─ Spill:  %.1f MB/sec", plot_rate(n * entry_size, spill_ms) / (1024 * 1024));
+    else
+        LOG_INFO("   └─ Spill:  none (single run)");
+    
+    /*
+     * STAGE 2: K-way merge into the plot file
+     * =======================================
+     * The run buffers and the output buffer split the budget evenly.
+     * Entries leave the heap in hash order and are appended to the
+     * file; index[p] is set when the first entry with prefix >= p
+     * goes out, exactly as plot_build_index() would.
+     */
+    uint64_t merge_start = get_current_time_ms();
+    size_t buf_records = budget / (run_count + 1) / entry_size;
+    if (buf_records < PLOT_STREAM_MIN_BUFFER) buf_records = PLOT_STREAM_MIN_BUFFER;
+    for (uint32_t r = 0; r < run_count && run_count > 1; r++) {
+        runs[r].buf = safe_malloc(buf_records * entry_size);
+        runs[r].cap = buf_records;
+        rewind(runs[r].f);
+    }
+    
+    uint32_t bits = plot_index_bits_for(n);
+    uint64_t slots = (uint64_t)1 << bits;
+    uint64_t data_end = PLOT_FILE_DATA_OFFSET + n * entry_size;
+    uint64_t index_offset = plot_index_offset(data_end);
+    index = safe_malloc((slots + 1) * sizeof(uint32_t));
+    out_buf = safe_malloc(buf_records * entry_size);
+    
+    out = fopen(tmp_path, "wb");
+    if (!out) {
+        LOG_ERROR("plot_generate_to_file: cannot open %s for write", tmp_path);
+        goto done;
+    }
+    if (!plot_write_header(out, &header, (uint8_t)entry_size, (uint8_t)bits, index_offset))
+        goto write_failed;
+    
+    PlotMerge merge = { runs, NULL, 0, entry_size, key_offset, key_len };
+    heap = safe_malloc(run_count * sizeof(uint32_t));
+    merge.heap = heap;
+    for (uint32_t r = 0; r < run_count; r++)
+        if (plot_run_fill(&runs[r], entry_size)) heap[merge.size++] = r;
+    for (uint32_t i = merge.size / 2; i-- > 0; ) plot_merge_sift_down(&merge, i);
+    
+    uint64_t written = 0;
+    uint64_t next_slot = 0;
+    size_t out_len = 0;
+    uint64_t last_progress = 0;
+    while (merge.size > 0) {
+        uint32_t r = heap[0];
+        const uint8_t* rec = runs[r].buf + runs[r].pos * entry_size;
+        
+        uint64_t p = plot_hash_prefix(rec + key_offset, bits);
+        while (next_slot <= p) index[next_slot++] = (uint32_t)written;
+        memcpy(out_buf + out_len * entry_size, rec, entry_size);
+        written++;
+        if (++out_len == buf_records) {
+            if (fwrite(out_buf, entry_size, out_len, out) != out_len) goto write_failed;
+            out_len = 0;
+        }
+        
+        runs[r].pos++;
+        if (!plot_run_fill(&runs[r], entry_size)) heap[0] = heap[--merge.size];
+        plot_merge_sift_down(&merge, 0);
+        
+        // Progress logging every 10%
+        if (written % PLOT_PROGRESS_STEP != 0) continue;
+        uint64_t progress = written * 100 / n;
+        if (progress >= last_progress + 10) {
+            LOG_INFO("   📊 Merge: %lu%% (%.0f entries/sec)", progress,
+                     plot_rate(written, get_current_time_ms() - merge_start));
+            last_progress = progress;
+        }
+    }
+    if (out_len > 0 && fwrite(out_buf, entry_size, out_len, out) != out_len) goto write_failed;
+    for (uint32_t r = 0; r < run_count; r++) {
+        if (runs[r].error) {
+            LOG_ERROR("❌ Short read from plot run %u", r);
+            goto done;
+        }
+    }
+    if (written != n) {
+        LOG_ERROR("❌ Merge produced %lu of %lu entries", written, n);
+        goto done;
+    }
+    while (next_slot <= slots) index[next_slot++] = (uint32_t)n;
+    
+    if ((index_offset != data_end &&
+         fwrite(plot_zero_page, index_offset - data_end, 1, out) != 1) ||
+        fwrite(index, sizeof(uint32_t), slots + 1, out) != slots + 1 ||
+        fflush(out) != 0 || fsync(fileno(out)) != 0)
+        goto write_failed;
+    fclose(out);
+    out = NULL;
+    if (rename(tmp_path, path) != 0) goto write_failed;
+    
+    uint64_t merge_ms = get_current_time_ms() - merge_start;
+    uint64_t total_ms = get_current_time_ms() - start_time;
+    uint64_t moved = n * entry_size * (run_count > 1 ? 2 : 1);
+    LOG_INFO("⚙️  ════════════════════════════════════════════════════════════");
+    LOG_INFO("⚙️  STREAMING PLOT GENERATION COMPLETE");
+    LOG_INFO("   ├─ Merge:      %lu ms (%.0f entries/sec, %.1f MB/sec read+write)", merge_ms,
+             plot_rate(n, merge_ms), plot_rate(moved, merge_ms) / (1024 * 1024));
+    LOG_INFO("   ├─ Total:      %lu ms (%.0f entries/sec)", total_ms, plot_rate(n, total_ms));
+    LOG_INFO("   └─ Plot file:  %s (%lu MB, prefix index %u bits)", path,
+             (index_offset + (slots + 1) * sizeof(uint32_t)) >> 20, bits);
+    LOG_INFO("⚙️  ════════════════════════════════════════════════════════════");
+    ok = true;
+    goto done;
+    
+write_failed:
+    LOG_ERROR("plot_generate_to_file: short write to %s", tmp_path);
+done:
+    if (out) fclose(out);
+    if (!ok) unlink(tmp_path);
+    for (uint32_t r = 0; r < run_count; r++) {
+        if (runs[r].f) fclose(runs[r].f);
+        free(runs[r].buf);
+    }
+    free(runs);
+    free(heap);
+    free(index);
+    free(out_buf);
+    free(buf);
+    return ok;
+}
+
 // ============================================================================
 // BINARY SEARCH - Find Entry Closest to Target
 // ============================================================================
@@ -330,10 +1153,23 @@ static uint64_t binary_search_closest(const Plot* plot, const uint8_t target[28]
     uint64_t left = 0;
     uint64_t right = plot->entry_count;
     
+    // The prefix index narrows the search to the target's bucket; the
+    // insertion point always lies in [index[p], index[p+1]]
+    if (plot->index) {
+        uint32_t p = plot_hash_prefix(target, plot->index_bits);
+        uint64_t lo = plot->index[p];
+        uint64_t hi = plot->index[p + 1];
+        if (lo <= hi && hi <= plot->entry_count) {
+            left = lo;
+            right = hi;
+        }
+    }
+    
     // Standard binary search to find insertion point
+    size_t key_len = plot_key_len(plot);
     while (left < right) {
         uint64_t mid = left + (right - left) / 2;
-        if (memcmp(plot->entries[mid].hash, target, 28) < 0) {
+        if (memcmp(plot_key(plot, mid), target, key_len) < 0) {
             left = mid + 1;
         } else {
             right = mid;
@@ -346,10 +1182,12 @@ static uint64_t binary_search_closest(const Plot* plot, const uint8_t target[28]
     
     // Compare distances to find which is actually closer
     // (the insertion point might not be the closest)
+    const uint8_t* key_left = plot_key(plot, left);
+    const uint8_t* key_prev = plot_key(plot, left - 1);
     uint64_t dist_left = 0, dist_prev = 0;
     for (int i = 0; i < 8 && i < 28; i++) {
-        dist_left = (dist_left << 8) | (plot->entries[left].hash[i] ^ target[i]);
-        dist_prev = (dist_prev << 8) | (plot->entries[left-1].hash[i] ^ target[i]);
+        dist_left = (dist_left << 8) | (key_left[i] ^ target[i]);
+        dist_prev = (dist_prev << 8) | (key_prev[i] ^ target[i]);
     }
     
     return (dist_prev <= dist_left) ? (left - 1) : left;
@@ -364,6 +1202,24 @@ static void calculate_distance(const uint8_t hash[28], const uint8_t target[28],
     }
 }
 
+// Entries [first, first + n) with full hashes (n <= PLOT_HASH_BATCH): copied
+// from a full plot, recomputed as BLAKE3(plot_id || nonce) for a compact one
+static void plot_window_entries(const Plot* plot, uint64_t first, uint32_t n, PlotEntry* out) {
+    if (!plot->compact) {
+        memcpy(out, plot->entries + first, n * sizeof(PlotEntry));
+        return;
+    }
+    
+    uint32_t nonces[PLOT_HASH_BATCH] = {0};
+    uint8_t hashes[PLOT_HASH_BATCH][28];
+    for (uint32_t j = 0; j < n; j++) nonces[j] = plot->compact[first + j].nonce;
+    plot_hash_nonces(plot->plot_id, nonces, n, hashes);
+    for (uint32_t j = 0; j < n; j++) {
+        out[j].nonce = nonces[j];
+        memcpy(out[j].hash, hashes[j], 28);
+    }
+}
+
 PlotEntry* plot_binary_search(const Plot* plot, 
                               const uint8_t target[28],
                               uint64_t* found_count) {
@@ -400,33 +1256,11 @@ PlotEntry* plot_binary_search(const Plot* plot,
 //   If difficulty <= 24, this is a valid proof
 // ============================================================================
 
-SpaceProof* plot_find_proof(const Plot* plot, 
-                            const uint8_t challenge[32],
-                            uint32_t difficulty) {
-    if (!plot || !plot->is_sorted) return NULL;
-    
-    uint64_t start_time = get_current_time_ms();
-    uint32_t target_zeros = difficulty_to_target_bits(difficulty);
-    
-    LOG_INFO("🔍 ────────────────────────────────────────────────────────────");
-    LOG_INFO("🔍 SEARCHING FOR PROOF");
-    LOG_INFO("   ├─ Challenge:  %.16s...", "");  // Would need hex conversion
-    LOG_INFO("   ├─ Difficulty: %u (requires %u leading zero bits)", difficulty, target_zeros);
-    LOG_INFO("   └─ Plot size:  %lu entries", plot->entry_count);
-    
-    /*
-     * STEP 1: Derive target from challenge
-     * =====================================
-     * target = BLAKE3(challenge)[0:28]
-     * 
-     * This transforms the challenge into a 28-byte value
-     * that we'll search for in our plot.
-     */
-    uint8_t full_target[32];
-    blake3_hash(challenge, 32, full_target);
-    uint8_t target[28];
-    memcpy(target, full_target, 28);
-    
+// Steps 2-5 for one plot: best entry near target meeting target_zeros,
+// or NULL. Adds the entries examined to *checked and *met_difficulty.
+static SpaceProof* plot_search(const Plot* plot, const uint8_t target[28],
+                               uint32_t target_zeros,
+                               uint32_t* checked, uint32_t* met_difficulty) {
     /*
      * STEP 2: Binary search for closest entry
      * =======================================
@@ -445,6 +1279,8 @@ SpaceProof* plot_find_proof(const Plot* plot,
      * The binary search gives us the closest entry,
      * but due to XOR distance properties, neighbors
      * might actually be better. Check a small window.
+     * A compact plot only stores hash prefixes, so the window's
+     * full hashes are recomputed from their nonces first.
      */
     int64_t start_idx = (int64_t)closest_idx - 2;
     int64_t end_idx = (int64_t)closest_idx + 3;
@@ -452,12 +1288,12 @@ SpaceProof* plot_find_proof(const Plot* plot,
     if (start_idx < 0) start_idx = 0;
     if (end_idx > (int64_t)plot->entry_count) end_idx = plot->entry_count;
     
-    uint32_t checked = 0;
-    uint32_t met_difficulty = 0;
+    PlotEntry window[5];
+    plot_window_entries(plot, (uint64_t)start_idx, (uint32_t)(end_idx - start_idx), window);
     
     for (int64_t i = start_idx; i < end_idx; i++) {
-        PlotEntry* entry = &plot->entries[i];
-        checked++;
+        PlotEntry* entry = &window[i - start_idx];
+        (*checked)++;
         
         /*
          * STEP 4: Calculate quality as XOR distance
@@ -480,7 +1316,7 @@ SpaceProof* plot_find_proof(const Plot* plot,
             continue;  // Doesn't meet difficulty - skip
         }
         
-        met_difficulty++;
+        (*met_difficulty)++;
         
         // Check if this is better than our current best
         if (memcmp(quality, best_quality, 32) < 0) {
@@ -497,13 +1333,16 @@ SpaceProof* plot_find_proof(const Plot* plot,
         }
     }
     
-    uint64_t search_time = get_current_time_ms() - start_time;
-    benchmark_validator_work(search_time);
-    
+    return best_proof;
+}
+
+static void log_search_result(const SpaceProof* best_proof, uint32_t target_zeros,
+                              uint32_t checked, uint32_t met_difficulty,
+                              uint64_t search_time) {
     if (best_proof) {
         char quality_hex[65];
-        bytes_to_hex_buf(best_quality, 32, quality_hex);
-        uint32_t zeros = count_leading_zeros(best_quality, 32);
+        bytes_to_hex_buf(best_proof->quality, 32, quality_hex);
+        uint32_t zeros = count_leading_zeros(best_proof->quality, 32);
         
         LOG_INFO("🔍 ────────────────────────────────────────────────────────────");
         LOG_INFO("🎯 PROOF FOUND!");
@@ -518,6 +1357,104 @@ SpaceProof* plot_find_proof(const Plot* plot,
         LOG_INFO("   ├─ Checked:      %u entries", checked);
         LOG_INFO("   └─ Search time:  %lu ms", search_time);
     }
+}
+
+SpaceProof* plot_find_proof(const Plot* plot, 
+                            const uint8_t challenge[32],
+                            uint32_t difficulty) {
+    if (!plot || !plot->is_sorted) return NULL;
+    
+    uint64_t start_time = get_current_time_ms();
+    uint32_t target_zeros = difficulty_to_target_bits(difficulty);
+    
+    LOG_INFO("🔍 ────────────────────────────────────────────────────────────");
+    LOG_INFO("🔍 SEARCHING FOR PROOF");
+    LOG_INFO("   ├─ Challenge:  %.16s...", "");  // Would need hex conversion
+    LOG_INFO("   ├─ Difficulty: %u (requires %u leading zero bits)", difficulty, target_zeros);
+    LOG_INFO("   └─ Plot size:  %lu entries", plot->entry_count);
+    
+    /*
+     * STEP 1: Derive target from challenge
+     * =====================================
+     * target = BLAKE3(challenge)[0:28]
+     * 
+     * This transforms the challenge into a 28-byte value
+     * that we'll search for in our plot.
+     */
+    uint8_t full_target[32];
+    blake3_hash(challenge, 32, full_target);
+    uint8_t target[28];
+    memcpy(target, full_target, 28);
+    
+    uint32_t checked = 0;
+    uint32_t met_difficulty = 0;
+    SpaceProof* best_proof = plot_search(plot, target, target_zeros, &checked, &met_difficulty);
+    
+    uint64_t search_time = get_current_time_ms() - start_time;
+    benchmark_validator_work(search_time);
+    log_search_result(best_proof, target_zeros, checked, met_difficulty, search_time);
+    
+    return best_proof;
+}
+
+// ============================================================================
+// MULTI-PLOT SEARCH
+// ============================================================================
+//
+// A farmer with several plots answers each challenge with the single best
+// proof over all of them. Plots are independent, so each one is searched
+// by its own thread. A search of a mapped plot is a handful of page
+// faults, which block on the disk rather than use the CPU, so up to
+// PLOT_SEARCH_THREADS searches run at once regardless of the core count.
+// ============================================================================
+
+SpaceProof* plot_find_proof_many(Plot* const* plots, uint32_t count,
+                                 const uint8_t challenge[32],
+                                 uint32_t difficulty) {
+    if (!plots || count == 0) return NULL;
+    if (count == 1) return plot_find_proof(plots[0], challenge, difficulty);
+    
+    uint64_t start_time = get_current_time_ms();
+    uint32_t target_zeros = difficulty_to_target_bits(difficulty);
+    
+    uint8_t full_target[32];
+    blake3_hash(challenge, 32, full_target);
+    uint8_t target[28];
+    memcpy(target, full_target, 28);
+    
+    SpaceProof** found = safe_malloc(count * sizeof(SpaceProof*));
+    uint32_t checked = 0;
+    uint32_t met_difficulty = 0;
+    uint64_t entries = 0;
+    int threads = count < PLOT_SEARCH_THREADS ? (int)count : PLOT_SEARCH_THREADS;
+    
+    #pragma omp parallel for schedule(dynamic, 1) num_threads(threads) \
+            reduction(+:checked, met_difficulty, entries)
+    for (uint32_t i = 0; i < count; i++) {
+        found[i] = NULL;
+        if (!plots[i] || !plots[i]->is_sorted) continue;
+        found[i] = plot_search(plots[i], target, target_zeros, &checked, &met_difficulty);
+        entries += plots[i]->entry_count;
+    }
+    
+    // Lowest quality wins; the rest are dropped
+    SpaceProof* best_proof = NULL;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!found[i]) continue;
+        if (!best_proof || proof_compare_quality(found[i], best_proof) < 0) {
+            free(best_proof);
+            best_proof = found[i];
+        } else {
+            free(found[i]);
+        }
+    }
+    free(found);
+    
+    uint64_t search_time = get_current_time_ms() - start_time;
+    benchmark_validator_work(search_time);
+    LOG_INFO("🔍 Searched %u plots (%lu entries, difficulty %u) on %d threads",
+             count, entries, difficulty, threads);
+    log_search_result(best_proof, target_zeros, checked, met_difficulty, search_time);
     
     return best_proof;
 }
@@ -922,9 +1859,13 @@ void difficulty_destroy(DifficultyState* state) {
 void plot_destroy(Plot* plot) {
     if (!plot) return;
     
-    if (plot->entries) {
+    plot_free_index(plot);
+    if (plot->map_base) {
+        munmap(plot->map_base, plot->map_length);
+    } else if (plot->entries || plot->compact) {
         LOG_INFO("🗑️  Freeing plot with %lu entries...", plot->entry_count);
         free(plot->entries);
+        free(plot->compact);
     }
     free(plot);
 }
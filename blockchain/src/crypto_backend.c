@@ -22,17 +22,21 @@
  *   liboqs 0.15.0 for Falcon-512 and ML-DSA-44
  *
  * Thread safety:
- *   crypto_verify_typed() is re-entrant — it creates a temporary OQS_SIG context
- *   per call and does not touch shared state. Use it freely in OpenMP verify loops.
+ *   crypto_verify_typed() is re-entrant — each thread lazily allocates its own
+ *   OQS_SIG verifier per scheme (thread-local) and reuses it for every later call.
+ *   The only shared state is the Ed25519 decoded-key cache, which is sharded and
+ *   locked per shard. Use it freely in OpenMP verify loops.
  *   crypto_sign() is NOT re-entrant for Falcon: each thread must own its own
  *   crypto_ctx_t because Falcon's Gaussian sampler has per-context PRNG state.
- *   Call crypto_thread_cleanup() before thread exit in liboqs builds.
+ *   Call crypto_thread_cleanup() before thread exit in liboqs builds; it frees the
+ *   calling thread's cached verifiers in addition to OQS_thread_stop().
  */
 
 #include "../include/crypto_backend.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <pthread.h>
 
 /* ==================================================================
  * Determine which backends to compile
@@ -67,6 +71,38 @@
 #include <oqs/oqs.h>
 #endif
 
+/* ==================================================================
+ * Per-thread verifier cache (liboqs)
+ * ================================================================== */
+#if COMPILE_FALCON || COMPILE_ML_DSA
+
+/*
+ * One OQS_SIG per scheme per thread, created on first verify and reused until
+ * crypto_thread_cleanup(). OQS_SIG_verify() only reads the algorithm descriptor,
+ * so a verifier can be reused indefinitely by its owning thread. This removes
+ * an OQS_SIG_new()/OQS_SIG_free() pair from every TX in the validator's
+ * OpenMP verify loop (up to 65K per block).
+ */
+#if COMPILE_FALCON
+static __thread OQS_SIG *tl_falcon_verifier = NULL;
+#endif
+#if COMPILE_ML_DSA
+static __thread OQS_SIG *tl_mldsa_verifier = NULL;
+#endif
+
+/**
+ * tl_verifier — Return the calling thread's cached verifier for alg_name.
+ *
+ * @param slot      Thread-local slot (tl_falcon_verifier / tl_mldsa_verifier).
+ * @param alg_name  liboqs algorithm identifier used on first allocation.
+ * @return Cached OQS_SIG, or NULL if liboqs allocation fails.
+ */
+static OQS_SIG *tl_verifier(OQS_SIG **slot, const char *alg_name) {
+    if (!*slot) *slot = OQS_SIG_new(alg_name);
+    return *slot;
+}
+#endif /* COMPILE_FALCON || COMPILE_ML_DSA */
+
 /* ==================================================================
  * Unified struct crypto_ctx
  * ================================================================== */
@@ -208,12 +244,97 @@ static bool ed25519_sign(crypto_ctx_t *ctx,
     return ok;
 }
 
+/* ------------------------------------------------------------------
+ * Decoded public-key cache
+ * ------------------------------------------------------------------
+ * A few hundred hot wallets send thousands of TXs per block, and every
+ * verify used to rebuild the same EVP_PKEY from 32 raw bytes. Decoded keys
+ * are kept in a bounded, sharded, direct-mapped cache shared by all threads.
+ *
+ * Keyed by the raw 32-byte key itself rather than hash160(pubkey): it is
+ * already shorter than a useful digest plus the full-key check a hit would
+ * need, and Ed25519 keys are uniformly distributed so the first 8 bytes
+ * serve directly as the slot hash.
+ *
+ * Lookups return a new reference (EVP_PKEY_up_ref) taken under the shard
+ * lock, so an entry evicted by another thread stays valid until the caller
+ * frees its reference. EVP_PKEY is safe to verify with concurrently.
+ * ------------------------------------------------------------------ */
+#define PUBKEY_CACHE_SHARDS       64
+#define PUBKEY_CACHE_SLOTS_PER    128   /* 64 x 128 = 8192 keys total */
+
+typedef struct {
+    uint8_t   pk[32];
+    EVP_PKEY *pkey;   /* NULL = empty slot */
+} pubkey_cache_slot_t;
+
+typedef struct {
+    pthread_mutex_t     lock;
+    pubkey_cache_slot_t slots[PUBKEY_CACHE_SLOTS_PER];
+} pubkey_cache_shard_t;
+
+static pubkey_cache_shard_t pubkey_cache[PUBKEY_CACHE_SHARDS];
+static pthread_once_t pubkey_cache_once = PTHREAD_ONCE_INIT;
+static uint64_t pubkey_cache_hits = 0;
+static uint64_t pubkey_cache_misses = 0;
+
+static void pubkey_cache_init(void) {
+    for (int i = 0; i < PUBKEY_CACHE_SHARDS; i++)
+        pthread_mutex_init(&pubkey_cache[i].lock, NULL);
+}
+
+/**
+ * ed25519_pubkey_get — Return a decoded EVP_PKEY for a raw Ed25519 key.
+ *
+ * Served from the shared cache when present; otherwise decoded and inserted,
+ * replacing whatever occupied the slot.
+ *
+ * @param pubkey  32-byte raw Ed25519 public key.
+ * @return New reference the caller must EVP_PKEY_free(), or NULL on EVP error.
+ */
+static EVP_PKEY *ed25519_pubkey_get(const uint8_t *pubkey) {
+    pthread_once(&pubkey_cache_once, pubkey_cache_init);
+
+    uint64_t h;
+    memcpy(&h, pubkey, sizeof(h));
+    pubkey_cache_shard_t *shard = &pubkey_cache[h % PUBKEY_CACHE_SHARDS];
+    pubkey_cache_slot_t *slot =
+        &shard->slots[(h / PUBKEY_CACHE_SHARDS) % PUBKEY_CACHE_SLOTS_PER];
+
+    EVP_PKEY *pkey = NULL;
+    pthread_mutex_lock(&shard->lock);
+    if (slot->pkey && memcmp(slot->pk, pubkey, 32) == 0 &&
+        EVP_PKEY_up_ref(slot->pkey) == 1)
+        pkey = slot->pkey;
+    pthread_mutex_unlock(&shard->lock);
+
+    if (pkey) {
+        __atomic_fetch_add(&pubkey_cache_hits, 1, __ATOMIC_RELAXED);
+        return pkey;
+    }
+    __atomic_fetch_add(&pubkey_cache_misses, 1, __ATOMIC_RELAXED);
+
+    /* Decode outside the lock; a racing thread may insert the same key first,
+     * in which case the last writer wins and both references stay valid. */
+    pkey = EVP_PKEY_new_raw_public_key(EVP_PKEY_ED25519, NULL, pubkey, 32);
+    if (!pkey) return NULL;
+    if (EVP_PKEY_up_ref(pkey) != 1) return pkey;   /* usable, just not cached */
+
+    pthread_mutex_lock(&shard->lock);
+    EVP_PKEY *old = slot->pkey;
+    slot->pkey = pkey;
+    memcpy(slot->pk, pubkey, 32);
+    pthread_mutex_unlock(&shard->lock);
+    if (old) EVP_PKEY_free(old);
+    return pkey;
+}
+
 /**
  * ed25519_verify — Verify an Ed25519 signature.
  *
- * Stateless: constructs a temporary EVP_PKEY from the raw public key bytes,
- * verifies, then frees it. Safe to call concurrently from multiple threads
- * since no shared state is accessed.
+ * Takes the decoded key from the shared public-key cache, verifies with a
+ * fresh EVP_MD_CTX, then drops its key reference. Safe to call concurrently
+ * from multiple threads.
  *
  * @param sig        The signature bytes (must be exactly 64 bytes for Ed25519).
  * @param sig_len    Length of sig; returns false if 0.
@@ -227,7 +348,7 @@ static bool ed25519_verify(const uint8_t *sig, size_t sig_len,
                             const uint8_t *msg, size_t msg_len,
                             const uint8_t *pubkey, size_t pubkey_len) {
     if (pubkey_len < 32 || sig_len == 0) return false;
-    EVP_PKEY *pkey = EVP_PKEY_new_raw_public_key(EVP_PKEY_ED25519, NULL, pubkey, 32);
+    EVP_PKEY *pkey = ed25519_pubkey_get(pubkey);
     if (!pkey) return false;
 
     EVP_MD_CTX *ctx = EVP_MD_CTX_new();
@@ -241,6 +362,55 @@ static bool ed25519_verify(const uint8_t *sig, size_t sig_len,
     EVP_PKEY_free(pkey);
     return ok;
 }
+
+/*
+ * Reusable state for ed25519_verify_batched(). One EVP_MD_CTX serves the
+ * whole batch, and the EVP_PKEY reference is kept while consecutive items
+ * carry the same public key — the pool hands TXs out grouped by sender, so a
+ * batch touches the shared key cache once per sender run instead of per TX.
+ */
+typedef struct {
+    EVP_MD_CTX *md;
+    EVP_PKEY   *pkey;
+    uint8_t     pk[32];
+} ed25519_batch_t;
+
+/**
+ * ed25519_verify_batched — ed25519_verify() using a batch's shared state.
+ *
+ * Same acceptance rule as ed25519_verify (it is the same OpenSSL call); only
+ * the allocation of the digest context and key object is amortized.
+ *
+ * @param b          Batch state, zero-initialised by the caller.
+ * @return true if the signature is valid, false otherwise.
+ */
+static bool ed25519_verify_batched(ed25519_batch_t *b,
+                                   const uint8_t *sig, size_t sig_len,
+                                   const uint8_t *msg, size_t msg_len,
+                                   const uint8_t *pubkey, size_t pubkey_len) {
+    if (pubkey_len < 32 || sig_len == 0) return false;
+
+    if (!b->pkey || memcmp(b->pk, pubkey, 32) != 0) {
+        if (b->pkey) EVP_PKEY_free(b->pkey);
+        b->pkey = ed25519_pubkey_get(pubkey);
+        if (!b->pkey) return false;
+        memcpy(b->pk, pubkey, 32);
+    }
+    if (!b->md) {
+        b->md = EVP_MD_CTX_new();
+        if (!b->md) return false;
+    } else {
+        EVP_MD_CTX_reset(b->md);
+    }
+
+    return EVP_DigestVerifyInit(b->md, NULL, NULL, NULL, b->pkey) == 1 &&
+           EVP_DigestVerify(b->md, sig, sig_len, msg, msg_len) == 1;
+}
+
+static void ed25519_batch_free(ed25519_batch_t *b) {
+    if (b->md) EVP_MD_CTX_free(b->md);
+    if (b->pkey) EVP_PKEY_free(b->pkey);
+}
 #endif /* COMPILE_ED25519 */
 
 /* ==================================================================
@@ -312,15 +482,16 @@ static bool falcon_sign(crypto_ctx_t *ctx,
 }
 
 /**
- * falcon_verify — Verify a Falcon-512 signature (stateless, thread-safe).
+ * falcon_verify — Verify a Falcon-512 signature (thread-safe).
  *
- * Allocates a temporary OQS_SIG context, verifies the signature, then frees it.
- * Creating a new OQS_SIG per call costs ~µs but eliminates all shared state,
- * making this function safe for parallel verification in OpenMP loops.
+ * Uses the calling thread's cached OQS_SIG (see tl_verifier) instead of
+ * allocating a context per call. Nothing is shared between threads, so this
+ * remains safe for parallel verification in OpenMP loops.
  *
- * Performance note: At 23,877 verify/sec (Xeon 6242 single-core), the context
- * allocation overhead is negligible (<1% of total time). At 10 cores, throughput
- * scales to ~184K verify/sec with 96.4% efficiency (see docs/RESULTS.md §5.2).
+ * Performance note: At 23,877 verify/sec (Xeon 6242 single-core). At 10 cores,
+ * throughput scales to ~184K verify/sec with 96.4% efficiency (see
+ * docs/RESULTS.md §5.2). `benchmark` reports the per-verify saving of the
+ * cached context vs. OQS_SIG_new()/OQS_SIG_free() per call.
  *
  * @param sig        Falcon-512 signature bytes (variable length, max 666B).
  * @param sig_len    Actual signature length (as returned by falcon_sign).
@@ -333,11 +504,9 @@ static bool falcon_sign(crypto_ctx_t *ctx,
 static bool falcon_verify(const uint8_t *sig, size_t sig_len,
                            const uint8_t *msg, size_t msg_len,
                            const uint8_t *pubkey, size_t pubkey_len) {
-    OQS_SIG *s = OQS_SIG_new(OQS_SIG_alg_falcon_512);
+    OQS_SIG *s = tl_verifier(&tl_falcon_verifier, OQS_SIG_alg_falcon_512);
     if (!s) return false;
-    bool ok = (OQS_SIG_verify(s, msg, msg_len, sig, sig_len, pubkey) == OQS_SUCCESS);
-    OQS_SIG_free(s);
-    return ok;
+    return (OQS_SIG_verify(s, msg, msg_len, sig, sig_len, pubkey) == OQS_SUCCESS);
 }
 #endif /* COMPILE_FALCON */
 
@@ -411,10 +580,10 @@ static bool mldsa_sign(crypto_ctx_t *ctx,
 }
 
 /**
- * mldsa_verify — Verify an ML-DSA-44 signature (stateless, thread-safe).
+ * mldsa_verify — Verify an ML-DSA-44 signature (thread-safe).
  *
- * Allocates a temporary OQS_SIG, verifies, frees. Same thread-safety guarantee
- * as falcon_verify — safe for concurrent use in OpenMP loops.
+ * Uses the calling thread's cached OQS_SIG, same as falcon_verify — safe for
+ * concurrent use in OpenMP loops.
  *
  * Performance: 46K–49K verify/sec on Xeon with AVX-512 (liboqs NTT path),
  * 25K/sec on M2 Pro ARM. ML-DSA is the fastest NIST PQC scheme for verification
@@ -434,11 +603,9 @@ static bool mldsa_sign(crypto_ctx_t *ctx,
 static bool mldsa_verify(const uint8_t *sig, size_t sig_len,
                           const uint8_t *msg, size_t msg_len,
                           const uint8_t *pubkey, size_t pubkey_len) {
-    OQS_SIG *s = OQS_SIG_new(OQS_SIG_alg_ml_dsa_44);
+    OQS_SIG *s = tl_verifier(&tl_mldsa_verifier, OQS_SIG_alg_ml_dsa_44);
     if (!s) return false;
-    bool ok = (OQS_SIG_verify(s, msg, msg_len, sig, sig_len, pubkey) == OQS_SUCCESS);
-    OQS_SIG_free(s);
-    return ok;
+    return (OQS_SIG_verify(s, msg, msg_len, sig, sig_len, pubkey) == OQS_SUCCESS);
 }
 #endif /* COMPILE_ML_DSA */
 
@@ -571,7 +738,130 @@ bool crypto_verify_typed(uint8_t sig_type,
     }
 }
 
+/**
+ * crypto_verify_many — Verify n independent signatures in one call.
+ *
+ * Each item is judged exactly as crypto_verify_typed() would judge it; the
+ * call only amortizes per-call setup:
+ *   - Ed25519: one EVP_MD_CTX for the batch, and the decoded public key is
+ *     reused across consecutive items from the same sender.
+ *   - Falcon-512 / ML-DSA-44: the thread's cached OQS_SIG is looked up once.
+ *     liboqs takes raw key bytes, so there is no separate decode to hoist.
+ *
+ * This is deliberately not a randomized Ed25519 batch equation. OpenSSL
+ * exposes no point arithmetic to build one on, and a batch check is only
+ * safe as the cofactored equation, while EVP_DigestVerify (every other node,
+ * and proof of a single TX) is cofactorless. The two disagree on signatures
+ * with small-order components, so a batch could accept a TX that the rest of
+ * the network rejects. Items are therefore checked one by one, and a failure
+ * needs no bisection to locate.
+ *
+ * Not internally parallel: callers split work across threads and give each
+ * thread a contiguous slice (keeps same-sender runs together).
+ *
+ * @param sig_types   Per-item scheme (SIG_ED25519 / SIG_FALCON512 / ...).
+ * @param sigs        Per-item signature pointer (NULL → item invalid).
+ * @param sig_lens    Per-item signature length.
+ * @param msgs        Per-item message pointer.
+ * @param msg_lens    Per-item message length.
+ * @param pubkeys     Per-item raw public key pointer (NULL → item invalid).
+ * @param pubkey_lens Per-item public key length.
+ * @param n           Number of items.
+ * @param results     Output, n bytes: 1 = valid, 0 = invalid.
+ * @return true if every item verified, false if any failed.
+ */
+bool crypto_verify_many(const uint8_t *sig_types,
+                        const uint8_t *const *sigs, const size_t *sig_lens,
+                        const uint8_t *const *msgs, const size_t *msg_lens,
+                        const uint8_t *const *pubkeys, const size_t *pubkey_lens,
+                        size_t n, uint8_t *results) {
+#if COMPILE_ED25519
+    ed25519_batch_t ed = {0};
+#endif
+#if COMPILE_FALCON
+    OQS_SIG *falcon = NULL;
+#endif
+#if COMPILE_ML_DSA
+    OQS_SIG *mldsa = NULL;
+#endif
+    bool all_ok = true;
+
+    for (size_t i = 0; i < n; i++) {
+        bool ok = false;
+        if (sigs[i] && pubkeys[i]) {
+            switch (sig_types[i]) {
+#if COMPILE_ED25519
+                case SIG_ED25519:
+                    ok = ed25519_verify_batched(&ed, sigs[i], sig_lens[i],
+                                                msgs[i], msg_lens[i],
+                                                pubkeys[i], pubkey_lens[i]);
+                    break;
+#endif
+#if COMPILE_FALCON
+                case SIG_FALCON512:
+                    if (!falcon) falcon = tl_verifier(&tl_falcon_verifier, OQS_SIG_alg_falcon_512);
+                    ok = falcon && OQS_SIG_verify(falcon, msgs[i], msg_lens[i],
+                                                  sigs[i], sig_lens[i], pubkeys[i]) == OQS_SUCCESS;
+                    break;
+#endif
+#if COMPILE_ML_DSA
+                case SIG_ML_DSA44:
+                    if (!mldsa) mldsa = tl_verifier(&tl_mldsa_verifier, OQS_SIG_alg_ml_dsa_44);
+                    ok = mldsa && OQS_SIG_verify(mldsa, msgs[i], msg_lens[i],
+                                                 sigs[i], sig_lens[i], pubkeys[i]) == OQS_SUCCESS;
+                    break;
+#endif
+                default:
+                    ok = crypto_verify_typed(sig_types[i], sigs[i], sig_lens[i],
+                                             msgs[i], msg_lens[i],
+                                             pubkeys[i], pubkey_lens[i]);
+                    break;
+            }
+        }
+        results[i] = ok ? 1 : 0;
+        if (!ok) all_ok = false;
+    }
+
+#if COMPILE_ED25519
+    ed25519_batch_free(&ed);
+#endif
+    return all_ok;
+}
+
+/**
+ * crypto_pubkey_cache_stats — Report decoded public-key cache counters.
+ *
+ * Counts lookups since process start. liboqs verifies directly from raw key
+ * bytes (there is no public pre-expanded key form), so only Ed25519 keys go
+ * through the cache; Falcon/ML-DSA-only builds always report 0 / 0.
+ *
+ * @param hits    Receives the number of lookups served from the cache (may be NULL).
+ * @param misses  Receives the number of lookups that decoded a key (may be NULL).
+ */
+void crypto_pubkey_cache_stats(uint64_t *hits, uint64_t *misses) {
+#if COMPILE_ED25519
+    if (hits)   *hits   = __atomic_load_n(&pubkey_cache_hits, __ATOMIC_RELAXED);
+    if (misses) *misses = __atomic_load_n(&pubkey_cache_misses, __ATOMIC_RELAXED);
+#else
+    if (hits)   *hits   = 0;
+    if (misses) *misses = 0;
+#endif
+}
+
+/**
+ * crypto_thread_cleanup — Release the calling thread's crypto resources.
+ *
+ * Frees the thread-local verifiers created by crypto_verify_typed() and then
+ * calls OQS_thread_stop(). Safe to call more than once; a later verify on the
+ * same thread simply re-creates the verifier.
+ */
 void crypto_thread_cleanup(void) {
+#if COMPILE_FALCON
+    if (tl_falcon_verifier) { OQS_SIG_free(tl_falcon_verifier); tl_falcon_verifier = NULL; }
+#endif
+#if COMPILE_ML_DSA
+    if (tl_mldsa_verifier) { OQS_SIG_free(tl_mldsa_verifier); tl_mldsa_verifier = NULL; }
+#endif
 #if COMPILE_FALCON || COMPILE_ML_DSA
     OQS_thread_stop();
 #endif
@@ -6,7 +6,15 @@
  *   - Google Protocol Buffers serialization/deserialization times
  *   - ZeroMQ messaging latency
  *   - Proof search and plot generation times
- *   - BLAKE3 hashing performance
+ *   - BLAKE3 hashing performance, scalar vs. SIMD blake3_hash_many()
+ *   - Signature verify overhead (per-call vs. per-thread cached OQS_SIG)
+ *   - Transaction pool add / confirm / contains on a full pool (--pool)
+ *   - Transaction pool GET_FOR_WINNER fetch with 1M pending TXs (--pool)
+ *   - Transaction pool arena churn with pinned long-lived TXs (--pool)
+ *   - Ledger lookups and 65K-TX block apply with 1M accounts (--ledger)
+ *   - Block memory footprint: empty / 65K-TX blocks, RSS of a chain (--memory)
+ *   - Block adopt with an attached on-disk block store (--store)
+ *   - Plot sort: radix plot_sort() vs. qsort at k=20/24/28 (--sort)
  * ============================================================================
  */
 
@@ -17,11 +25,18 @@
 #include "../include/crypto_backend.h"
 #include "../include/common.h"
 #include "../include/blake3.h"
+#include "../include/transaction_pool.h"
+#include "../include/blockchain.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include <dirent.h>
 #include <zmq.h>
+#if SIG_SCHEME != SIG_ED25519
+#include <oqs/oqs.h>
+#endif
 
 static uint64_t get_time_ns(void) {
     struct timespec ts;
@@ -192,38 +207,741 @@ static void benchmark_blake3(int iterations, BenchStats* hash_stats) {
     }
 }
 
+/*
+ * Hashes a batch of short messages the way the hot callers do: 36-byte
+ * plot inputs (plot_id || nonce) and 64-byte TX hash inputs, 28-byte output.
+ * "scalar" is one blake3_hash_truncated() per message (the old path),
+ * "many" is one blake3_hash_many() call for the whole batch.
+ */
+#define BLAKE3_BENCH_BATCH 1024
+
+static void benchmark_blake3_many(int iterations, size_t input_len,
+                                  BenchStats* scalar_stats, BenchStats* many_stats) {
+    uint8_t* data = safe_malloc((size_t)BLAKE3_BENCH_BATCH * input_len);
+    const uint8_t** inputs = safe_malloc(BLAKE3_BENCH_BATCH * sizeof(uint8_t*));
+    uint8_t* out = safe_malloc((size_t)BLAKE3_BENCH_BATCH * 28);
+    uint8_t* ref = safe_malloc((size_t)BLAKE3_BENCH_BATCH * 28);
+
+    for (size_t i = 0; i < (size_t)BLAKE3_BENCH_BATCH * input_len; i++) data[i] = rand() & 0xFF;
+    for (int i = 0; i < BLAKE3_BENCH_BATCH; i++) inputs[i] = data + (size_t)i * input_len;
+    size_t bytes = (size_t)BLAKE3_BENCH_BATCH * input_len;
+
+    for (int it = 0; it < iterations; it++) {
+        data[0] = it & 0xFF;
+
+        uint64_t start = get_time_ns();
+        for (int i = 0; i < BLAKE3_BENCH_BATCH; i++)
+            blake3_hash_truncated(inputs[i], input_len, ref + (size_t)i * 28, 28);
+        record_stat(scalar_stats, get_time_ns() - start, bytes);
+
+        start = get_time_ns();
+        blake3_hash_many(inputs, BLAKE3_BENCH_BATCH, input_len, out, 28);
+        record_stat(many_stats, get_time_ns() - start, bytes);
+    }
+
+    if (memcmp(out, ref, (size_t)BLAKE3_BENCH_BATCH * 28) != 0)
+        printf("  WARNING: blake3_hash_many output differs from scalar path!\n");
+
+    free(data);
+    free((void*)inputs);
+    free(out);
+    free(ref);
+}
+
+/* ============================================================================
+ * SIGNATURE VERIFICATION BENCHMARKS
+ * ============================================================================ */
+
+/*
+ * Compares the old verify path (OQS_SIG_new + verify + OQS_SIG_free per call)
+ * against crypto_verify_typed(), which reuses a per-thread cached verifier.
+ * The difference between the two averages is the per-verify context overhead.
+ * Ed25519 builds have no OQS context, so only the cached path is reported.
+ */
+static void benchmark_verify_ctx_reuse(int iterations, BenchStats* fresh_stats,
+                                       BenchStats* cached_stats) {
+    printf("  Running verify context benchmark (%d iterations)...\n", iterations);
+
+    Wallet* wallet = wallet_create_named("bench_verify", SIG_SCHEME);
+    if (!wallet) return;
+    uint8_t dest_addr[20];
+    memset(dest_addr, 0x5A, 20);
+
+    Transaction* tx = transaction_create(wallet, dest_addr, 100, 1, 0, 0);
+    if (!tx) { wallet_destroy(wallet); return; }
+    uint8_t tx_hash[TX_HASH_SIZE];
+    transaction_compute_hash(tx, tx_hash);
+
+#if SIG_SCHEME != SIG_ED25519
+    const char* alg = NULL;
+    if (tx->sig_type == SIG_FALCON512) alg = OQS_SIG_alg_falcon_512;
+    else if (tx->sig_type == SIG_ML_DSA44) alg = OQS_SIG_alg_ml_dsa_44;
+
+    for (int i = 0; alg && i < iterations; i++) {
+        uint64_t start = get_time_ns();
+        OQS_SIG* s = OQS_SIG_new(alg);
+        bool ok = s && OQS_SIG_verify(s, tx_hash, TX_HASH_SIZE, tx->signature,
+                                      tx->sig_len, tx->public_key) == OQS_SUCCESS;
+        OQS_SIG_free(s);
+        uint64_t t = get_time_ns() - start;
+        if (ok) record_stat(fresh_stats, t, tx->sig_len);
+    }
+#else
+    (void)fresh_stats;
+#endif
+
+    // Warm the thread-local verifier so the first-call allocation is excluded
+    crypto_verify_typed(tx->sig_type, tx->signature, tx->sig_len,
+                        tx_hash, TX_HASH_SIZE, tx->public_key, tx->pubkey_len);
+    for (int i = 0; i < iterations; i++) {
+        uint64_t start = get_time_ns();
+        bool ok = crypto_verify_typed(tx->sig_type, tx->signature, tx->sig_len,
+                                      tx_hash, TX_HASH_SIZE,
+                                      tx->public_key, tx->pubkey_len);
+        uint64_t t = get_time_ns() - start;
+        if (ok) record_stat(cached_stats, t, tx->sig_len);
+    }
+
+    crypto_thread_cleanup();
+    transaction_destroy(tx);
+    wallet_destroy(wallet);
+}
+
+/* ============================================================================
+ * TRANSACTION POOL BENCHMARKS
+ * ============================================================================ */
+
+/*
+ * Fills a pool with `fill` synthetic unsigned TXs (the pool does not verify),
+ * then confirms a 65K-hash block against it `rounds` times, re-adding the
+ * confirmed TXs between rounds so every round runs against a full pool.
+ * One add / contains sample per TX; one confirm sample per 65K block.
+ */
+#define POOL_BENCH_BLOCK_TXS 65536
+
+static void benchmark_pool_confirm(uint32_t fill, int rounds, BenchStats* add_stats,
+                                   BenchStats* confirm_stats, BenchStats* contains_stats) {
+    TransactionPool* pool = pool_create();
+    if (!pool) return;
+    if (fill == 0 || fill > pool->capacity) fill = pool->capacity;
+    uint32_t block_txs = fill < POOL_BENCH_BLOCK_TXS ? fill : POOL_BENCH_BLOCK_TXS;
+    uint32_t stride = fill / block_txs;
+
+    printf("  Running pool benchmark (%u TXs, %u-hash confirm x %d rounds)...\n",
+           fill, block_txs, rounds);
+
+    Transaction* tx = safe_malloc(sizeof(Transaction));
+    memset(tx, 0, sizeof(Transaction));
+    memset(tx->dest_address, 0xCD, 20);
+    tx->value = 1;
+    tx->fee = 1;
+
+    set_log_level(LOG_WARN);  // pool_add logs every 10K TXs
+    for (uint32_t i = 0; i < fill; i++) {
+        memcpy(tx->source_address, &i, sizeof(i));   // 1 TX per sender
+        tx->nonce = i;
+        uint64_t start = get_time_ns();
+        bool ok = pool_add(pool, tx);
+        uint64_t add_time = get_time_ns() - start;
+        if (ok) record_stat(add_stats, add_time, TX_HASH_SIZE);
+    }
+
+    // Hashes of every stride-th TX = one "block" spread across the pool
+    uint8_t* hashes = safe_malloc((size_t)block_txs * TX_HASH_SIZE);
+    for (uint32_t b = 0; b < block_txs; b++) {
+        uint32_t i = b * stride;
+        memcpy(tx->source_address, &i, sizeof(i));
+        tx->nonce = i;
+        transaction_compute_hash(tx, hashes + (size_t)b * TX_HASH_SIZE);
+    }
+
+    for (uint32_t b = 0; b < block_txs; b++) {
+        uint64_t start = get_time_ns();
+        bool found = pool_contains(pool, hashes + (size_t)b * TX_HASH_SIZE);
+        uint64_t contains_time = get_time_ns() - start;
+        if (found) record_stat(contains_stats, contains_time, TX_HASH_SIZE);
+    }
+
+    for (int r = 0; r < rounds; r++) {
+        uint64_t start = get_time_ns();
+        uint32_t confirmed = pool_confirm_batch(pool, hashes, block_txs);
+        uint64_t confirm_time = get_time_ns() - start;
+        record_stat(confirm_stats, confirm_time, (size_t)confirmed * TX_HASH_SIZE);
+        if (confirmed != block_txs)
+            printf("  WARNING: confirmed %u/%u\n", confirmed, block_txs);
+
+        for (uint32_t b = 0; b < block_txs; b++) {
+            uint32_t i = b * stride;
+            memcpy(tx->source_address, &i, sizeof(i));
+            tx->nonce = i;
+            pool_add(pool, tx);
+        }
+    }
+    set_log_level(LOG_INFO);
+
+    free(hashes);
+    free(tx);
+    pool_destroy(pool);
+}
+
+/*
+ * Fills a pool with `fill` pending TXs from fill / POOL_BENCH_TXS_PER_SENDER
+ * senders, added nonce-round by nonce-round (every sender's nonce 0, then
+ * every sender's nonce 1, ...) the way concurrent wallets interleave. Then
+ * times pool_get_pending_with_pubkeys() for a 65K-TX block `rounds` times,
+ * plus a 1K-TX fetch to show cost tracks K rather than the pool size.
+ */
+#define POOL_BENCH_FETCH_FILL      1000000
+#define POOL_BENCH_TXS_PER_SENDER  16
+
+static void benchmark_pool_fetch(uint32_t fill, int rounds, BenchStats* fetch_stats,
+                                 BenchStats* fetch_small_stats) {
+    TransactionPool* pool = pool_create();
+    if (!pool) return;
+    if (fill == 0) fill = POOL_BENCH_FETCH_FILL;
+    if (fill > pool->capacity) fill = pool->capacity;
+    uint32_t senders = fill / POOL_BENCH_TXS_PER_SENDER;
+    if (senders == 0) senders = 1;
+
+    printf("  Running pool fetch benchmark (%u pending TXs, %u senders, x %d rounds)...\n",
+           fill, senders, rounds);
+
+    Transaction* tx = safe_malloc(sizeof(Transaction));
+    memset(tx, 0, sizeof(Transaction));
+    memset(tx->dest_address, 0xCD, 20);
+    tx->value = 1;
+    tx->fee = 1;
+
+    set_log_level(LOG_WARN);
+    for (uint32_t i = 0; i < fill; i++) {
+        uint32_t sender = i % senders;
+        memcpy(tx->source_address, &sender, sizeof(sender));
+        tx->nonce = i / senders;
+        pool_add(pool, tx);
+    }
+
+    TxArena* arena = tx_arena_create(0);
+    uint32_t sizes[2] = { POOL_BENCH_BLOCK_TXS, 1000 };
+    BenchStats* stats[2] = { fetch_stats, fetch_small_stats };
+    for (int k = 0; k < 2; k++) {
+        for (int r = 0; r < rounds; r++) {
+            uint32_t count = 0;
+            uint8_t* flags = NULL;
+            tx_arena_reset(arena);
+            uint64_t start = get_time_ns();
+            TxView** txs = pool_get_pending_with_pubkeys(pool, arena, sizes[k], 0, &count,
+                                                         NULL, NULL, NULL, &flags);
+            uint64_t fetch_time = get_time_ns() - start;
+            record_stat(stats[k], fetch_time, arena->bytes_used);
+            free(txs);
+            free(flags);
+        }
+    }
+    set_log_level(LOG_INFO);
+
+    tx_arena_destroy(arena);
+    free(tx);
+    pool_destroy(pool);
+}
+
+/*
+ * Slab arena churn: every round adds one slab's worth of maximum-size TXs
+ * (CRYPTO_SIG_MAX signature, CRYPTO_PUBKEY_MAX pubkey) from fresh senders,
+ * plus one no-expiry TX from a pinned sender that is never confirmed, then
+ * confirms the round's other TXs. Each round leaves one live TX behind in
+ * the slab it filled; the arena must compact those slabs instead of keeping
+ * one per round, so the slab count has to stay within POOL_BENCH_CHURN_SLABS.
+ * One sample per round (adds + confirm).
+ */
+#define POOL_BENCH_CHURN_SLABS 4
+
+static void benchmark_pool_churn(int rounds, BenchStats* churn_stats) {
+    TransactionPool* pool = pool_create();
+    if (!pool) return;
+    uint32_t tx_bytes = (uint32_t)(sizeof(PoolTxBody) + CRYPTO_SIG_MAX + CRYPTO_PUBKEY_MAX);
+    uint32_t per_round = POOL_SLAB_SIZE / tx_bytes + 1;
+
+    printf("  Running pool churn benchmark (%u TXs per round, 1 pinned, x %d rounds)...\n",
+           per_round, rounds);
+
+    Transaction* tx = safe_malloc(sizeof(Transaction));
+    memset(tx, 0, sizeof(Transaction));
+    memset(tx->dest_address, 0xCD, 20);
+    memset(tx->signature, 0x5A, CRYPTO_SIG_MAX);
+    tx->sig_len = CRYPTO_SIG_MAX;
+    tx->pubkey_len = CRYPTO_PUBKEY_MAX;
+    tx->value = 1;
+    tx->fee = 1;
+    uint8_t* hashes = safe_malloc((size_t)per_round * TX_HASH_SIZE);
+    uint32_t sender = 0;
+
+    set_log_level(LOG_WARN);
+    for (int r = 0; r < rounds; r++) {
+        uint64_t start = get_time_ns();
+        for (uint32_t i = 0; i < per_round; i++) {
+            sender++;
+            memset(tx->source_address, 0, 20);
+            memcpy(tx->source_address, &sender, sizeof(sender));
+            memset(tx->public_key, (int)(sender & 0xFF), CRYPTO_PUBKEY_MAX);
+            memcpy(tx->public_key, &sender, sizeof(sender));
+            tx->nonce = 0;
+            transaction_compute_hash(tx, hashes + (size_t)i * TX_HASH_SIZE);
+            pool_add(pool, tx);
+        }
+
+        memset(tx->source_address, 0xFF, 20);
+        memset(tx->public_key, 0xFF, CRYPTO_PUBKEY_MAX);
+        tx->nonce = (uint64_t)r;
+        pool_add(pool, tx);
+
+        uint32_t confirmed = pool_confirm_batch(pool, hashes, per_round);
+        record_stat(churn_stats, get_time_ns() - start, (size_t)per_round * tx_bytes);
+        if (confirmed != per_round)
+            printf("  WARNING: confirmed %u/%u\n", confirmed, per_round);
+    }
+    set_log_level(LOG_INFO);
+
+    if (pool->count != (uint32_t)rounds)
+        printf("  WARNING: %u TXs left in the pool, expected %d\n", pool->count, rounds);
+    printf("  Arena slabs after churn: %u (limit %d)\n", pool->slab_count, POOL_BENCH_CHURN_SLABS);
+    if (pool->slab_count > POOL_BENCH_CHURN_SLABS)
+        printf("  WARNING: pool arena grew to %u slabs for %u live TXs\n",
+               pool->slab_count, pool->count);
+
+    free(hashes);
+    free(tx);
+    pool_destroy(pool);
+}
+
+/* ============================================================================
+ * LEDGER BENCHMARKS
+ * ============================================================================ */
+
+/*
+ * Funds `accounts` synthetic addresses (one account-creating credit each),
+ * times one balance lookup per account, then applies `rounds` blocks of
+ * POOL_BENCH_BLOCK_TXS transfers between random funded accounts through
+ * blockchain_process_block(). Every transfer does a sender probe and a
+ * receiver probe, so block time is dominated by the address index.
+ * Each block is applied to two identically funded chains, one with
+ * parallel apply and one sequential, and the final ledgers are compared.
+ * A final untimed block mixes in out-of-range amounts (wrapping value + fee,
+ * value past INT64_MAX) that both paths must reject.
+ */
+#define LEDGER_BENCH_ACCOUNTS  1000000
+
+static void ledger_bench_address(uint32_t i, uint8_t address[20]) {
+    memset(address, 0x5A, 20);
+    memcpy(address, &i, sizeof(i));
+}
+
+static void benchmark_ledger(uint32_t accounts, int rounds, BenchStats* credit_stats,
+                             BenchStats* lookup_stats, BenchStats* apply_stats,
+                             BenchStats* apply_seq_stats) {
+    if (accounts == 0) accounts = LEDGER_BENCH_ACCOUNTS;
+
+    printf("  Running ledger benchmark (%u accounts, %d-TX blocks x %d rounds)...\n",
+           accounts, POOL_BENCH_BLOCK_TXS, rounds);
+
+    set_log_level(LOG_ERROR);  // process_block warns per skipped TX
+    Blockchain* bc = blockchain_create();
+    Blockchain* seq = blockchain_create();
+    blockchain_set_parallel_apply(seq, false);
+    uint8_t address[20];
+
+    for (uint32_t i = 0; i < accounts; i++) {
+        ledger_bench_address(i, address);
+        uint64_t start = get_time_ns();
+        blockchain_credit_address(bc, address, 1000000);
+        record_stat(credit_stats, get_time_ns() - start, 20);
+        blockchain_credit_address(seq, address, 1000000);
+    }
+
+    uint64_t checksum = 0;
+    for (uint32_t i = 0; i < accounts; i++) {
+        ledger_bench_address((uint32_t)(((uint64_t)i * 2654435761u) % accounts), address);
+        uint64_t start = get_time_ns();
+        checksum += blockchain_get_balance(bc, address);
+        record_stat(lookup_stats, get_time_ns() - start, 20);
+    }
+    if (checksum != (uint64_t)accounts * 1000000)
+        printf("  WARNING: ledger checksum mismatch (%lu)\n", checksum);
+
+    Transaction* tx = safe_malloc(sizeof(Transaction));
+    for (int r = 0; r < rounds; r++) {
+        Block* block = block_create();
+        block->header.height = (uint32_t)r + 1;
+        memset(tx, 0, sizeof(Transaction));
+        tx->value = 1;
+        tx->fee = 1;
+        for (uint32_t t = 0; t < POOL_BENCH_BLOCK_TXS; t++) {
+            ledger_bench_address((uint32_t)rand() % accounts, tx->source_address);
+            ledger_bench_address((uint32_t)rand() % accounts, tx->dest_address);
+            tx->nonce = (uint64_t)r;
+            block_add_transaction(block, tx);
+        }
+
+        uint64_t start = get_time_ns();
+        blockchain_process_block(bc, block);
+        record_stat(apply_stats, get_time_ns() - start,
+                    (size_t)block->header.transaction_count * sizeof(LedgerAccount));
+
+        start = get_time_ns();
+        blockchain_process_block(seq, block);
+        record_stat(apply_seq_stats, get_time_ns() - start,
+                    (size_t)block->header.transaction_count * sizeof(LedgerAccount));
+        block_destroy(block);
+    }
+
+    // Out-of-range amounts (value + fee past INT64_MAX, or wrapping) must be
+    // rejected identically by both paths: an unfunded sender's wrapped
+    // value + fee (which would credit UINT64_MAX to an empty account) and a
+    // funded sender's oversized value, in a block big enough to take the
+    // parallel path.
+    uint8_t unfunded[20];
+    ledger_bench_address(accounts, unfunded);
+    Block* block = block_create();
+    block->header.height = (uint32_t)rounds + 1;
+    memset(tx, 0, sizeof(Transaction));
+    for (uint32_t t = 0; t < PARALLEL_APPLY_MIN_TXS; t++) {
+        ledger_bench_address((uint32_t)rand() % accounts, tx->source_address);
+        ledger_bench_address((uint32_t)rand() % accounts, tx->dest_address);
+        tx->nonce = (uint64_t)rounds;
+        tx->value = 1;
+        tx->fee = 1;
+        if (t % 1024 == 0) {
+            memcpy(tx->source_address, unfunded, 20);
+            memcpy(tx->dest_address, unfunded, 20);
+            tx->value = UINT64_MAX;
+        } else if (t % 1024 == 1) {
+            tx->value = (uint64_t)INT64_MAX;
+        }
+        block_add_transaction(block, tx);
+    }
+    blockchain_process_block(bc, block);
+    blockchain_process_block(seq, block);
+    block_destroy(block);
+    for (uint32_t i = 0; i < bc->ledger_count; i++) {
+        if (bc->ledger[i].balance > (uint64_t)INT64_MAX) {
+            printf("  WARNING: out-of-range TX was applied\n");
+            break;
+        }
+    }
+    free(tx);
+
+    if (bc->ledger_count != seq->ledger_count ||
+        memcmp(bc->ledger, seq->ledger, (size_t)bc->ledger_count * sizeof(LedgerAccount)) != 0)
+        printf("  WARNING: parallel and sequential ledgers differ\n");
+
+    blockchain_destroy(seq);
+    blockchain_destroy(bc);
+    set_log_level(LOG_INFO);
+}
+
+/* ============================================================================
+ * BLOCK MEMORY FOOTPRINT BENCHMARKS
+ * ============================================================================
+ * Bytes held per block (struct + TX pointer array + TX arena) for an empty
+ * block and a sealed POOL_BENCH_BLOCK_TXS-TX block, and the resident set
+ * growth of a chain of MEMORY_BENCH_CHAIN_BLOCKS empty blocks (the metronome
+ * case). A fixed MAX_TRANSACTIONS_PER_BLOCK pointer array would cost
+ * 560 KB per block in every row.
+ */
+#define MEMORY_BENCH_CHAIN_BLOCKS  2000
+
+static size_t block_footprint(const Block* block) {
+    size_t bytes = sizeof(Block) + (size_t)block->tx_capacity * sizeof(TxView*);
+    if (block->arena) bytes += sizeof(TxArena) + block->arena->bytes_reserved;
+    return bytes;
+}
+
+static size_t read_rss_bytes(void) {
+    unsigned long size = 0, resident = 0;
+    FILE* f = fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    if (fscanf(f, "%lu %lu", &size, &resident) != 2) resident = 0;
+    fclose(f);
+    return (size_t)resident * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+static void benchmark_block_memory(int rounds, BenchStats* empty_stats,
+                                   BenchStats* full_stats, BenchStats* chain_stats) {
+    printf("  Running block memory benchmark (%d empty blocks, %d-TX blocks x 5, "
+           "%d-block chain)...\n", rounds, POOL_BENCH_BLOCK_TXS, MEMORY_BENCH_CHAIN_BLOCKS);
+
+    for (int r = 0; r < rounds; r++) {
+        uint64_t start = get_time_ns();
+        Block* block = block_create();
+        block_calculate_hash(block);
+        record_stat(empty_stats, get_time_ns() - start, block_footprint(block));
+        block_destroy(block);
+    }
+
+    Transaction* tx = safe_malloc(sizeof(Transaction));
+    memset(tx, 0, sizeof(Transaction));
+    tx->value = 1;
+    tx->fee = 1;
+    for (int r = 0; r < 5; r++) {
+        uint64_t start = get_time_ns();
+        Block* block = block_create();
+        for (uint32_t t = 0; t < POOL_BENCH_BLOCK_TXS; t++) {
+            tx->nonce = t;
+            block_add_transaction(block, tx);
+        }
+        block_compact(block);
+        record_stat(full_stats, get_time_ns() - start, block_footprint(block));
+        block_destroy(block);
+    }
+    free(tx);
+
+    // Resident growth per empty block as the chain keeps them
+    set_log_level(LOG_ERROR);
+    Blockchain* bc = blockchain_create();
+    size_t rss_before = read_rss_bytes();
+    for (uint32_t h = 1; h <= MEMORY_BENCH_CHAIN_BLOCKS; h++) {
+        Block* block = block_create();
+        block->header.height = h;
+        memcpy(block->header.previous_hash, bc->last_hash, 32);
+        block_calculate_hash(block);
+
+        uint64_t start = get_time_ns();
+        if (!blockchain_adopt_block(bc, block, NULL, 0)) {
+            block_destroy(block);
+            break;
+        }
+        record_stat(chain_stats, get_time_ns() - start, 0);
+    }
+    size_t rss_after = read_rss_bytes();
+    if (rss_after > rss_before) chain_stats->total_bytes = rss_after - rss_before;
+    blockchain_destroy(bc);
+    set_log_level(LOG_INFO);
+}
+
+/* ============================================================================
+ * BLOCK STORE BENCHMARKS
+ * ============================================================================
+ * Adopting 1-TX blocks into a chain with a block store attached (serialize,
+ * append, group-commit sync), in a scratch directory that is removed
+ * afterwards. A final untimed block arrives the way a legacy ADD_BLOCK does
+ * (hex, block_deserialize, adopt with no raw bytes) with fewer TXs than its
+ * header counts: it must be rejected, not serialized into the store.
+ */
+static void remove_store_dir(const char* dir) {
+    DIR* d = opendir(dir);
+    if (d) {
+        struct dirent* e;
+        char path[512];
+        while ((e = readdir(d)) != NULL) {
+            if (e->d_name[0] == '.') continue;
+            snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+            unlink(path);
+        }
+        closedir(d);
+    }
+    rmdir(dir);
+}
+
+static void benchmark_block_store(int rounds, BenchStats* append_stats) {
+    printf("  Running block store benchmark (%d blocks)...\n", rounds);
+
+    char dir[] = "/tmp/bench_store_XXXXXX";
+    if (!mkdtemp(dir)) {
+        printf("  WARNING: cannot create a scratch directory\n");
+        return;
+    }
+
+    set_log_level(LOG_ERROR);
+    Blockchain* bc = blockchain_create();
+    if (!blockchain_attach_store(bc, dir, 0)) {
+        printf("  WARNING: cannot attach a block store in %s\n", dir);
+        blockchain_destroy(bc);
+        remove_store_dir(dir);
+        set_log_level(LOG_INFO);
+        return;
+    }
+
+    Transaction* tx = safe_malloc(sizeof(Transaction));
+    memset(tx, 0, sizeof(Transaction));
+    memset(tx->dest_address, 0x5A, 20);
+    uint64_t bytes_before = bc->store->bytes_written;
+    for (int r = 0; r < rounds; r++) {
+        Block* block = block_create();
+        block->header.height = (uint32_t)bc->height;
+        memcpy(block->header.previous_hash, bc->last_hash, 32);
+        block_add_transaction(block, tx);
+        block_calculate_hash(block);
+
+        uint64_t start = get_time_ns();
+        if (!blockchain_adopt_block(bc, block, NULL, 0)) {
+            block_destroy(block);
+            break;
+        }
+        record_stat(append_stats, get_time_ns() - start, 0);
+    }
+    blockchain_sync(bc);
+    append_stats->total_bytes = bc->store->bytes_written - bytes_before;
+
+    // Header counts 3 TXs, the hex carries 1; the hash is valid because
+    // missing TXs hash as zero leaves
+    Block* block = block_create();
+    block->header.height = (uint32_t)bc->height;
+    memcpy(block->header.previous_hash, bc->last_hash, 32);
+    block_reserve(block, 3);
+    block_add_transaction(block, tx);
+    block->header.transaction_count = 3;
+    block_calculate_hash(block);
+    char* hex = block_serialize(block);
+    block_destroy(block);
+    free(tx);
+
+    uint64_t height = bc->height;
+    block = block_deserialize(hex);
+    free(hex);
+    if (block && blockchain_adopt_block(bc, block, NULL, 0)) {
+        printf("  WARNING: block with missing TXs was accepted\n");
+    } else if (block) {
+        block_destroy(block);
+    }
+    if (bc->height != height || block_store_height(bc->store) != height)
+        printf("  WARNING: block with missing TXs reached the store\n");
+
+    blockchain_destroy(bc);
+    remove_store_dir(dir);
+    set_log_level(LOG_INFO);
+}
+
 /* ============================================================================
  * PROOF OPERATIONS BENCHMARKS
  * ============================================================================ */
 
+/*
+ * Sorts a plot of uniform random hashes (what BLAKE3 produces) with the
+ * default plot_sort() and with the old qsort + plot_entry_compare path.
+ * Both runs see the same entries: they are regenerated from the same seed
+ * rather than copied, so k=28 needs 8 GB for the plot plus 8 GB of radix
+ * scratch instead of a third copy.
+ */
+#define SORT_BENCH_K_COUNT 3
+static const uint32_t SORT_BENCH_K[SORT_BENCH_K_COUNT] = {20, 24, 28};
+
+static void sort_bench_fill(Plot* plot, uint64_t seed) {
+    uint64_t x = seed;
+    for (uint64_t i = 0; i < plot->entry_count; i++) {
+        plot->entries[i].nonce = (uint32_t)i;
+        for (int b = 0; b < 28; b += 4) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;   // xorshift64
+            uint32_t w = (uint32_t)(x >> 32);
+            memcpy(plot->entries[i].hash + b, &w, 4);
+        }
+    }
+    plot->is_sorted = false;
+}
+
+static void benchmark_plot_sort(uint32_t k_param, BenchStats* radix_stats, BenchStats* qsort_stats) {
+    uint8_t farmer_addr[20];
+    memset(farmer_addr, 0xEF, 20);
+
+    set_log_level(LOG_WARN);
+    Plot* plot = plot_create(farmer_addr, k_param);
+    set_log_level(LOG_INFO);
+    if (!plot) return;
+    size_t bytes = plot->entry_count * sizeof(PlotEntry);
+
+    printf("  Sorting k=%u (%lu entries) with radix sort (%u threads)...\n",
+           k_param, plot->entry_count, plot_get_threads());
+    sort_bench_fill(plot, 0x9E3779B97F4A7C15ULL + k_param);
+    set_log_level(LOG_WARN);
+    uint64_t start = get_time_ns();
+    plot_sort(plot);
+    record_stat(radix_stats, get_time_ns() - start, bytes);
+    set_log_level(LOG_INFO);
+
+    printf("  Sorting k=%u with qsort...\n", k_param);
+    sort_bench_fill(plot, 0x9E3779B97F4A7C15ULL + k_param);
+    start = get_time_ns();
+    qsort(plot->entries, plot->entry_count, sizeof(PlotEntry), plot_entry_compare);
+    record_stat(qsort_stats, get_time_ns() - start, bytes);
+
+    set_log_level(LOG_WARN);
+    plot_destroy(plot);
+    set_log_level(LOG_INFO);
+}
+
 static void benchmark_proof_operations(int iterations, int k_param, 
-                                       BenchStats* plot_stats, BenchStats* search_stats) {
+                                       BenchStats* plot_stats, BenchStats* search_stats,
+                                       BenchStats* search_noindex_stats,
+                                       BenchStats* search_compact_stats) {
     printf("  Generating plot (k=%d)...\n", k_param);
     
     uint8_t farmer_addr[20];
     memset(farmer_addr, 0xEF, 20);
     
+    set_log_level(LOG_WARN);
     uint64_t start = get_time_ns();
     Plot* plot = plot_create(farmer_addr, k_param);
+    if (plot && !plot_generate(plot)) {
+        plot_destroy(plot);
+        plot = NULL;
+    }
     uint64_t plot_time = get_time_ns() - start;
     
-    if (!plot) return;
+    if (!plot) {
+        set_log_level(LOG_INFO);
+        return;
+    }
     record_stat(plot_stats, plot_time, (1ULL << k_param) * sizeof(PlotEntry));
     
-    printf("  Running proof search benchmark (%d searches)...\n", iterations);
+    // Compact copy of the same plot: 12-byte entries, hashes recomputed per search
+    plot_set_compact(true);
+    Plot* compact = plot_create(farmer_addr, k_param);
+    plot_set_compact(false);
+    if (compact) {
+        memcpy(compact->plot_id, plot->plot_id, 32);
+        if (!plot_generate(compact)) {
+            plot_destroy(compact);
+            compact = NULL;
+        }
+    }
+    
+    printf("  Running proof search benchmark (%d searches, prefix index %u bits)...\n",
+           iterations, plot->index_bits);
     
+    // Same challenges with and without the prefix index, and on the compact plot
+    uint32_t* index = plot->index;
     for (int i = 0; i < iterations; i++) {
         uint8_t challenge[32];
         for (int j = 0; j < 32; j++) challenge[j] = rand() & 0xFF;
         
+        plot->index = index;
         start = get_time_ns();
         SpaceProof* proof = plot_find_proof(plot, challenge, 1);
         uint64_t search_time = get_time_ns() - start;
-        
         record_stat(search_stats, search_time, sizeof(SpaceProof));
         if (proof) free(proof);
+        
+        plot->index = NULL;
+        start = get_time_ns();
+        proof = plot_find_proof(plot, challenge, 1);
+        search_time = get_time_ns() - start;
+        record_stat(search_noindex_stats, search_time, sizeof(SpaceProof));
+        if (proof) free(proof);
+        
+        if (!compact) continue;
+        start = get_time_ns();
+        proof = plot_find_proof(compact, challenge, 1);
+        search_time = get_time_ns() - start;
+        record_stat(search_compact_stats, search_time, sizeof(SpaceProof));
+        if (proof) free(proof);
+    }
+    plot->index = index;
+    if (compact) {
+        printf("  Plot size: %lu MB full, %lu MB compact\n",
+               plot->entry_count * sizeof(PlotEntry) / (1024 * 1024),
+               compact->entry_count * sizeof(PlotCompactEntry) / (1024 * 1024));
+        plot_destroy(compact);
     }
     plot_destroy(plot);
+    set_log_level(LOG_INFO);
 }
 
 /* ============================================================================
@@ -310,6 +1028,13 @@ int main(int argc, char* argv[]) {
     int iterations = 1000;
     int k_param = 16;
     const char* csv_file = NULL;
+    bool run_pool = false;
+    bool run_ledger = false;
+    bool run_memory = false;
+    bool run_store = false;
+    bool run_sort = false;
+    uint32_t sort_max_k = 28;
+    uint32_t pool_fill = 0;   // 0 = full pool (pool capacity)
     
     // Parse arguments
     for (int i = 1; i < argc; i++) {
@@ -319,6 +1044,22 @@ int main(int argc, char* argv[]) {
             k_param = atoi(argv[++i]);
         } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
             iterations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--pool") == 0) {
+            run_pool = true;
+        } else if (strcmp(argv[i], "--pool-fill") == 0 && i + 1 < argc) {
+            run_pool = true;
+            pool_fill = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--ledger") == 0) {
+            run_ledger = true;
+        } else if (strcmp(argv[i], "--memory") == 0) {
+            run_memory = true;
+        } else if (strcmp(argv[i], "--store") == 0) {
+            run_store = true;
+        } else if (strcmp(argv[i], "--sort") == 0) {
+            run_sort = true;
+        } else if (strcmp(argv[i], "--sort-max-k") == 0 && i + 1 < argc) {
+            run_sort = true;
+            sort_max_k = (uint32_t)atoi(argv[++i]);
         } else if (argv[i][0] != '-') {
             iterations = atoi(argv[i]);
             if (i + 1 < argc && argv[i+1][0] != '-') {
@@ -343,7 +1084,16 @@ int main(int argc, char* argv[]) {
     BenchStats block_ser_10, block_deser_10;
     BenchStats block_ser_100, block_deser_100;
     BenchStats blake3_stats;
-    BenchStats plot_stats, search_stats;
+    BenchStats blake3_scalar36, blake3_many36, blake3_scalar64, blake3_many64;
+    BenchStats verify_fresh, verify_cached;
+    BenchStats pool_add_stats, pool_confirm_stats, pool_contains_stats;
+    BenchStats pool_fetch_stats, pool_fetch_small_stats, pool_churn_stats;
+    BenchStats ledger_credit_stats, ledger_lookup_stats, ledger_apply_stats;
+    BenchStats ledger_apply_seq_stats;
+    BenchStats mem_empty_stats, mem_full_stats, mem_chain_stats;
+    BenchStats store_append_stats;
+    BenchStats sort_radix_stats[SORT_BENCH_K_COUNT], sort_qsort_stats[SORT_BENCH_K_COUNT];
+    BenchStats plot_stats, search_stats, search_noindex_stats, search_compact_stats;
     BenchStats zmq_inproc, zmq_tcp;
     
     init_stats(&tx_ser); init_stats(&tx_deser);
@@ -351,7 +1101,21 @@ int main(int argc, char* argv[]) {
     init_stats(&block_ser_10); init_stats(&block_deser_10);
     init_stats(&block_ser_100); init_stats(&block_deser_100);
     init_stats(&blake3_stats);
-    init_stats(&plot_stats); init_stats(&search_stats);
+    init_stats(&blake3_scalar36); init_stats(&blake3_many36);
+    init_stats(&blake3_scalar64); init_stats(&blake3_many64);
+    init_stats(&verify_fresh); init_stats(&verify_cached);
+    init_stats(&pool_add_stats); init_stats(&pool_confirm_stats); init_stats(&pool_contains_stats);
+    init_stats(&pool_fetch_stats); init_stats(&pool_fetch_small_stats);
+    init_stats(&pool_churn_stats);
+    init_stats(&ledger_credit_stats); init_stats(&ledger_lookup_stats);
+    init_stats(&ledger_apply_stats); init_stats(&ledger_apply_seq_stats);
+    init_stats(&mem_empty_stats); init_stats(&mem_full_stats); init_stats(&mem_chain_stats);
+    init_stats(&store_append_stats);
+    for (int i = 0; i < SORT_BENCH_K_COUNT; i++) {
+        init_stats(&sort_radix_stats[i]); init_stats(&sort_qsort_stats[i]);
+    }
+    init_stats(&plot_stats); init_stats(&search_stats); init_stats(&search_noindex_stats);
+    init_stats(&search_compact_stats);
     init_stats(&zmq_inproc); init_stats(&zmq_tcp);
     
     /* ========== GPB (Protocol Buffers) Benchmarks ========== */
@@ -388,15 +1152,134 @@ int main(int argc, char* argv[]) {
     printf("\n  BLAKE3 Hash (256 bytes input):\n");
     print_stats("Hash computation", &blake3_stats);
     
+    benchmark_blake3_many(iterations, 36, &blake3_scalar36, &blake3_many36);
+    benchmark_blake3_many(iterations, 64, &blake3_scalar64, &blake3_many64);
+    printf("\n  BLAKE3 batch of %d messages (kernel: %s, %zu lanes):\n",
+           BLAKE3_BENCH_BATCH, blake3_simd_name(), blake3_simd_lanes());
+    print_stats("36 B plot input, scalar", &blake3_scalar36);
+    print_stats("36 B plot input, hash_many", &blake3_many36);
+    print_stats("64 B TX input, scalar", &blake3_scalar64);
+    print_stats("64 B TX input, hash_many", &blake3_many64);
+    printf("  %-35s: %.2fx (36 B), %.2fx (64 B)\n", "hash_many speedup",
+           (double)blake3_scalar36.total_ns / blake3_many36.total_ns,
+           (double)blake3_scalar64.total_ns / blake3_many64.total_ns);
+    
+    /* ========== Signature Verify Benchmarks ========== */
+    printf("\n═══════════════════════════════════════════════════════════════════════════\n");
+    printf("  SIGNATURE VERIFY (%s)\n", CRYPTO_SCHEME_NAME);
+    printf("═══════════════════════════════════════════════════════════════════════════\n");
+    
+    benchmark_verify_ctx_reuse(iterations, &verify_fresh, &verify_cached);
+    printf("\n  Verify context overhead:\n");
+    print_stats("OQS_SIG_new + verify + free", &verify_fresh);
+    print_stats("crypto_verify_typed (cached ctx)", &verify_cached);
+    if (verify_fresh.count > 0 && verify_cached.count > 0) {
+        double fresh_us = (double)verify_fresh.total_ns / verify_fresh.count / 1000.0;
+        double cached_us = (double)verify_cached.total_ns / verify_cached.count / 1000.0;
+        printf("  %-35s: %.2f µs per verify\n", "Context overhead saved", fresh_us - cached_us);
+    }
+    
+    /* ========== Transaction Pool Benchmarks (opt-in: fills a full pool) ========== */
+    if (run_pool) {
+        printf("\n═══════════════════════════════════════════════════════════════════════════\n");
+        printf("  TRANSACTION POOL (hash index, pending queues)\n");
+        printf("═══════════════════════════════════════════════════════════════════════════\n");
+        
+        benchmark_pool_confirm(pool_fill, 5, &pool_add_stats, &pool_confirm_stats,
+                               &pool_contains_stats);
+        printf("\n  Pool operations:\n");
+        print_stats("pool_add (with dup check)", &pool_add_stats);
+        print_stats("pool_contains", &pool_contains_stats);
+        print_stats("pool_confirm_batch (65K hashes)", &pool_confirm_stats);
+        
+        benchmark_pool_fetch(pool_fill ? pool_fill : POOL_BENCH_FETCH_FILL, 5,
+                             &pool_fetch_stats, &pool_fetch_small_stats);
+        printf("\n  Pool fetch (GET_FOR_WINNER):\n");
+        print_stats("pool_get_pending (65K TXs)", &pool_fetch_stats);
+        print_stats("pool_get_pending (1K TXs)", &pool_fetch_small_stats);
+        
+        benchmark_pool_churn(32, &pool_churn_stats);
+        printf("\n  Pool arena churn (avg bytes = bytes added per round):\n");
+        print_stats("add + confirm 1 slab of TXs", &pool_churn_stats);
+    }
+    
+    /* ========== Ledger Benchmarks (opt-in: 1M accounts) ========== */
+    if (run_ledger) {
+        printf("\n═══════════════════════════════════════════════════════════════════════════\n");
+        printf("  LEDGER (address hash index)\n");
+        printf("═══════════════════════════════════════════════════════════════════════════\n");
+        
+        benchmark_ledger(LEDGER_BENCH_ACCOUNTS, 5, &ledger_credit_stats,
+                         &ledger_lookup_stats, &ledger_apply_stats,
+                         &ledger_apply_seq_stats);
+        printf("\n  Ledger operations:\n");
+        print_stats("credit (new account)", &ledger_credit_stats);
+        print_stats("get_balance (1M accounts)", &ledger_lookup_stats);
+        print_stats("process_block (65K TXs, parallel)", &ledger_apply_stats);
+        print_stats("process_block (65K TXs, sequential)", &ledger_apply_seq_stats);
+    }
+    
+    /* ========== Block Memory Benchmarks (opt-in) ========== */
+    if (run_memory) {
+        printf("\n═══════════════════════════════════════════════════════════════════════════\n");
+        printf("  BLOCK MEMORY FOOTPRINT\n");
+        printf("═══════════════════════════════════════════════════════════════════════════\n");
+        
+        benchmark_block_memory(iterations, &mem_empty_stats, &mem_full_stats, &mem_chain_stats);
+        printf("\n  Block allocation (avg bytes = bytes held per block):\n");
+        print_stats("block_create (empty)", &mem_empty_stats);
+        print_stats("build + compact (65K TXs)", &mem_full_stats);
+        print_stats("adopt empty block (RSS per block)", &mem_chain_stats);
+        printf("  %-35s: %zu bytes per block\n", "Fixed-array layout (reference)",
+               sizeof(Block) + (size_t)MAX_TRANSACTIONS_PER_BLOCK * sizeof(TxView*));
+    }
+    
+    /* ========== Block Store Benchmarks (opt-in: writes to /tmp) ========== */
+    if (run_store) {
+        printf("\n═══════════════════════════════════════════════════════════════════════════\n");
+        printf("  BLOCK STORE (on-disk log)\n");
+        printf("═══════════════════════════════════════════════════════════════════════════\n");
+        
+        benchmark_block_store(iterations, &store_append_stats);
+        printf("\n  Block store (avg bytes = log bytes per block):\n");
+        print_stats("adopt 1-TX block (store attached)", &store_append_stats);
+    }
+    
+    /* ========== Plot Sort Benchmarks (opt-in: up to 16 GB at k=28) ========== */
+    if (run_sort) {
+        printf("\n═══════════════════════════════════════════════════════════════════════════\n");
+        printf("  PLOT SORT (radix vs. qsort)\n");
+        printf("═══════════════════════════════════════════════════════════════════════════\n");
+        
+        for (int i = 0; i < SORT_BENCH_K_COUNT; i++) {
+            if (SORT_BENCH_K[i] > sort_max_k) continue;
+            benchmark_plot_sort(SORT_BENCH_K[i], &sort_radix_stats[i], &sort_qsort_stats[i]);
+        }
+        printf("\n  Plot sort (avg bytes = plot size):\n");
+        for (int i = 0; i < SORT_BENCH_K_COUNT; i++) {
+            if (sort_radix_stats[i].count == 0) continue;
+            char name[64];
+            snprintf(name, sizeof(name), "plot_sort radix (k=%u)", SORT_BENCH_K[i]);
+            print_stats(name, &sort_radix_stats[i]);
+            snprintf(name, sizeof(name), "qsort + memcmp (k=%u)", SORT_BENCH_K[i]);
+            print_stats(name, &sort_qsort_stats[i]);
+            printf("  %-35s: %.2fx\n", "radix speedup",
+                   (double)sort_qsort_stats[i].total_ns / sort_radix_stats[i].total_ns);
+        }
+    }
+    
     /* ========== Proof Operations Benchmarks ========== */
     printf("\n═══════════════════════════════════════════════════════════════════════════\n");
     printf("  PROOF OPERATIONS (k=%d)\n", k_param);
     printf("═══════════════════════════════════════════════════════════════════════════\n");
     
-    benchmark_proof_operations(iterations/10, k_param, &plot_stats, &search_stats);
+    benchmark_proof_operations(iterations/10, k_param, &plot_stats, &search_stats,
+                               &search_noindex_stats, &search_compact_stats);
     printf("\n  Plot and Search:\n");
     print_stats("Plot generation", &plot_stats);
-    print_stats("Proof search (binary search)", &search_stats);
+    print_stats("Proof search (prefix index)", &search_stats);
+    print_stats("Proof search (full binary search)", &search_noindex_stats);
+    print_stats("Proof search (compact plot)", &search_compact_stats);
     
     /* ========== ZMQ Benchmarks ========== */
     printf("\n═══════════════════════════════════════════════════════════════════════════\n");
@@ -420,6 +1303,7 @@ int main(int argc, char* argv[]) {
     double tx_deser_us = tx_deser.count > 0 ? (double)tx_deser.total_ns / tx_deser.count / 1000.0 : 0;
     double zmq_us = zmq_inproc.count > 0 ? (double)zmq_inproc.total_ns / zmq_inproc.count / 1000.0 : 0;
     double zmq_tcp_us = zmq_tcp.count > 0 ? (double)zmq_tcp.total_ns / zmq_tcp.count / 1000.0 : 0;
+    double verify_us = verify_cached.count > 0 ? (double)verify_cached.total_ns / verify_cached.count / 1000.0 : 0;
     double blake3_us = blake3_stats.count > 0 ? (double)blake3_stats.total_ns / blake3_stats.count / 1000.0 : 0;
     double search_us = search_stats.count > 0 ? (double)search_stats.total_ns / search_stats.count / 1000.0 : 0;
     double plot_ms = plot_stats.count > 0 ? (double)plot_stats.total_ns / plot_stats.count / 1000000.0 : 0;
@@ -428,6 +1312,32 @@ int main(int argc, char* argv[]) {
     printf("║  GPB Transaction deserialize:   %8.2f µs                              ║\n", tx_deser_us);
     printf("║  GPB Round-trip (ser+deser):    %8.2f µs                              ║\n", tx_ser_us + tx_deser_us);
     printf("║  BLAKE3 hash (256 bytes):       %8.2f µs                              ║\n", blake3_us);
+    printf("║  BLAKE3 1K x 64 B (scalar/many):%8.2f / %.2f µs                      ║\n",
+           (double)blake3_scalar64.total_ns / blake3_scalar64.count / 1000.0,
+           (double)blake3_many64.total_ns / blake3_many64.count / 1000.0);
+    printf("║  Signature verify (cached ctx): %8.2f µs                              ║\n", verify_us);
+    if (pool_confirm_stats.count > 0)
+        printf("║  Pool confirm (65K-TX block):   %8.2f ms                              ║\n",
+               (double)pool_confirm_stats.total_ns / pool_confirm_stats.count / 1000000.0);
+    if (pool_fetch_stats.count > 0)
+        printf("║  Pool fetch (65K of %4uK TXs):  %8.2f ms                              ║\n",
+               (pool_fill ? pool_fill : POOL_BENCH_FETCH_FILL) / 1000,
+               (double)pool_fetch_stats.total_ns / pool_fetch_stats.count / 1000000.0);
+    if (ledger_apply_stats.count > 0)
+        printf("║  Ledger apply 65K TXs (par/seq):%8.2f / %.2f ms                       ║\n",
+               (double)ledger_apply_stats.total_ns / ledger_apply_stats.count / 1000000.0,
+               (double)ledger_apply_seq_stats.total_ns / ledger_apply_seq_stats.count / 1000000.0);
+    if (mem_empty_stats.count > 0)
+        printf("║  Block footprint (empty/65K):   %8.0f B / %.1f MB                     ║\n",
+               (double)mem_empty_stats.total_bytes / mem_empty_stats.count,
+               (double)mem_full_stats.total_bytes / mem_full_stats.count / (1024.0 * 1024.0));
+    for (int i = 0; i < SORT_BENCH_K_COUNT; i++) {
+        if (sort_radix_stats[i].count == 0) continue;
+        printf("║  Plot sort k=%u (radix/qsort):  %8.0f / %.0f ms                       ║\n",
+               SORT_BENCH_K[i],
+               (double)sort_radix_stats[i].total_ns / 1000000.0,
+               (double)sort_qsort_stats[i].total_ns / 1000000.0);
+    }
     printf("║  ZMQ inproc round-trip:         %8.2f µs                              ║\n", zmq_us);
     printf("║  ZMQ TCP round-trip:            %8.2f µs                              ║\n", zmq_tcp_us);
     printf("║  Proof search (k=%d):           %8.2f µs                              ║\n", k_param, search_us);
@@ -458,8 +1368,37 @@ int main(int argc, char* argv[]) {
             print_stats_csv(f, "GPB", "block_100tx_serialize", &block_ser_100);
             print_stats_csv(f, "GPB", "block_100tx_deserialize", &block_deser_100);
             print_stats_csv(f, "BLAKE3", "hash_256bytes", &blake3_stats);
+            print_stats_csv(f, "BLAKE3", "hash_1k_x36b_scalar", &blake3_scalar36);
+            print_stats_csv(f, "BLAKE3", "hash_1k_x36b_many", &blake3_many36);
+            print_stats_csv(f, "BLAKE3", "hash_1k_x64b_scalar", &blake3_scalar64);
+            print_stats_csv(f, "BLAKE3", "hash_1k_x64b_many", &blake3_many64);
+            print_stats_csv(f, "Verify", "verify_fresh_ctx", &verify_fresh);
+            print_stats_csv(f, "Verify", "verify_cached_ctx", &verify_cached);
+            print_stats_csv(f, "Pool", "pool_add", &pool_add_stats);
+            print_stats_csv(f, "Pool", "pool_contains", &pool_contains_stats);
+            print_stats_csv(f, "Pool", "pool_confirm_batch_65k", &pool_confirm_stats);
+            print_stats_csv(f, "Pool", "pool_fetch_65k", &pool_fetch_stats);
+            print_stats_csv(f, "Pool", "pool_fetch_1k", &pool_fetch_small_stats);
+            print_stats_csv(f, "Pool", "pool_churn_slab_round", &pool_churn_stats);
+            print_stats_csv(f, "Ledger", "ledger_credit_new", &ledger_credit_stats);
+            print_stats_csv(f, "Ledger", "ledger_get_balance", &ledger_lookup_stats);
+            print_stats_csv(f, "Ledger", "ledger_apply_65k", &ledger_apply_stats);
+            print_stats_csv(f, "Ledger", "ledger_apply_65k_seq", &ledger_apply_seq_stats);
+            print_stats_csv(f, "Memory", "block_empty", &mem_empty_stats);
+            print_stats_csv(f, "Memory", "block_65k_compact", &mem_full_stats);
+            print_stats_csv(f, "Memory", "chain_empty_block_rss", &mem_chain_stats);
+            print_stats_csv(f, "Store", "adopt_1tx_block", &store_append_stats);
+            for (int i = 0; i < SORT_BENCH_K_COUNT; i++) {
+                char name[64];
+                snprintf(name, sizeof(name), "plot_sort_radix_k%u", SORT_BENCH_K[i]);
+                print_stats_csv(f, "Sort", name, &sort_radix_stats[i]);
+                snprintf(name, sizeof(name), "plot_sort_qsort_k%u", SORT_BENCH_K[i]);
+                print_stats_csv(f, "Sort", name, &sort_qsort_stats[i]);
+            }
             print_stats_csv(f, "Proof", "plot_generation", &plot_stats);
             print_stats_csv(f, "Proof", "proof_search", &search_stats);
+            print_stats_csv(f, "Proof", "proof_search_no_index", &search_noindex_stats);
+            print_stats_csv(f, "Proof", "proof_search_compact", &search_compact_stats);
             print_stats_csv(f, "ZMQ", "inproc_rtt", &zmq_inproc);
             print_stats_csv(f, "ZMQ", "tcp_rtt", &zmq_tcp);
             fclose(f);
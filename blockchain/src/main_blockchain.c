@@ -14,7 +14,7 @@
  *   CONFIRM_BLOCK:<height><count><hashes>    - For pool TX removal (binary)
  *
  * COMMANDS: ADD_BLOCK_PB, ADD_BLOCK, GET_LAST, GET_LAST_HASH, GET_HEIGHT,
- *           GET_BALANCE, GET_NONCE, GET_SUMMARY
+ *           GET_BALANCE, GET_NONCE, GET_TX_PROOF, GET_SUMMARY, GET_STATUS
  * ============================================================================
  */
 
@@ -22,6 +22,7 @@
 #include "../include/block.h"
 #include "../include/transaction.h"
 #include "../include/wallet.h"
+#include "../include/sig_cache.h"
 #include "../include/common.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -39,22 +40,212 @@ void signal_handler(int sig) {
     LOG_INFO("🛑 Shutdown signal received");
 }
 
+// =============================================================================
+// REPLIES AND DEFERRED BLOCK ACKS
+// =============================================================================
+// The REP-style protocol runs on a ROUTER socket (clients stay REQ), so a
+// reply can be addressed to any earlier requester. An accepted block's "OK",
+// BLOCK_CONFIRMED (metronome), NEW_BLOCK and CONFIRM_BLOCK (pool drop) are
+// queued until the group fdatasync covering the block: nobody acts on a
+// block a crash could still lose. Back-to-back blocks share one sync; the
+// group is synced as soon as a non-block request or an idle poll shows no
+// further block to batch. Without a block store acks go out immediately.
+
+static uint8_t reply_peer[256];            // Identity of the current requester
+static int reply_peer_len = 0;
+
+static void send_to_peer(void* socket, const uint8_t* peer, int peer_len,
+                         const void* data, size_t len) {
+    zmq_send(socket, peer, (size_t)peer_len, ZMQ_SNDMORE);
+    zmq_send(socket, "", 0, ZMQ_SNDMORE);  // REQ envelope delimiter
+    zmq_send(socket, data, len, 0);
+}
+
+static void reply(void* socket, const void* data, size_t len) {
+    send_to_peer(socket, reply_peer, reply_peer_len, data, len);
+}
+
+typedef struct {
+    uint8_t peer[256];
+    int peer_len;
+    uint32_t height;
+    uint32_t tx_count;
+    char block_hash_hex[65];
+    char farmer_name[64];
+    uint8_t* confirm_msg;                  // CONFIRM_BLOCK (NULL = no user TXs)
+    size_t confirm_len;
+    uint32_t confirm_count;
+#ifndef DIAG_OFF
+    size_t block_bytes;                    // ADD_BLOCK_PB only (0 = no diag row)
+    uint64_t t_recv_ns, t_unpack_ns, t_validate_ns, t_commit_ns;
+#endif
+} BlockAck;
+
+static BlockAck* pending_acks = NULL;
+static uint32_t pending_ack_count = 0;
+static uint32_t pending_ack_capacity = 0;
+
+// Capture everything the ack and notifications need while the block is at
+// hand (it may leave the hot window before the group is synced)
+static BlockAck* queue_block_ack(const Block* block, const char* farmer_name) {
+    if (pending_ack_count == pending_ack_capacity) {
+        pending_ack_capacity = pending_ack_capacity ? pending_ack_capacity * 2 : 16;
+        pending_acks = safe_realloc(pending_acks, pending_ack_capacity * sizeof(BlockAck));
+    }
+    BlockAck* ack = &pending_acks[pending_ack_count++];
+    memset(ack, 0, sizeof(*ack));
+    memcpy(ack->peer, reply_peer, (size_t)reply_peer_len);
+    ack->peer_len = reply_peer_len;
+    ack->height = block->header.height;
+    ack->tx_count = block->header.transaction_count;
+    bytes_to_hex_buf(block->header.hash, 32, ack->block_hash_hex);
+    safe_strcpy(ack->farmer_name, farmer_name, sizeof(ack->farmer_name));
+
+    // CONFIRM_BLOCK for pool TX removal (binary)
+    // =====================================================
+    // THIS IS THE CORRECT CONFIRMATION PATH.
+    // The blockchain has validated and accepted the block,
+    // so these TXs are truly confirmed. Pool subscribes
+    // to this PUB topic and removes them from pending.
+    //
+    // Format: "CONFIRM_BLOCK:" (14B) + height (4B) +
+    //         hash_count (4B) + N x TX_HASH_SIZE hashes
+    //
+    // Skip index 0 (coinbase - not in pool).
+    // =====================================================
+    uint32_t user_tx_count = ack->tx_count > 1 ? ack->tx_count - 1 : 0;
+    if (user_tx_count > 0) {
+        uint8_t* confirm_msg = safe_malloc(22 + (size_t)user_tx_count * TX_HASH_SIZE);
+        memcpy(confirm_msg, "CONFIRM_BLOCK:", 14);
+        memcpy(confirm_msg + 14, &ack->height, 4);
+
+        uint32_t hash_count = 0;
+        uint8_t* hash_ptr = confirm_msg + 22;
+        for (uint32_t ti = 1; ti <= user_tx_count; ti++) {
+            if (block->transactions[ti]) {
+                tx_view_compute_hash(block->transactions[ti], hash_ptr);
+                hash_ptr += TX_HASH_SIZE;
+                hash_count++;
+            }
+        }
+        memcpy(confirm_msg + 18, &hash_count, 4);
+        ack->confirm_msg = confirm_msg;
+        ack->confirm_len = 22 + (size_t)hash_count * TX_HASH_SIZE;
+        ack->confirm_count = hash_count;
+    }
+    return ack;
+}
+
+#ifndef DIAG_OFF
+static void diag_log_block(const BlockAck* ack, uint64_t t_send_ns) {
+    static FILE* bc_csv = NULL;
+    if (!bc_csv) {
+        char csv_path[64];
+        snprintf(csv_path, sizeof(csv_path), "blockchain_diag_%d.csv", getpid());
+        bc_csv = fopen(csv_path, "w");
+        if (bc_csv) {
+            fprintf(bc_csv,
+                "block_height,block_txs,block_bytes,"
+                "t_recv_ns,t_unpack_ns,t_validate_ns,"
+                "t_commit_ns,t_send_ns,recv_to_send_ns\n");
+            fflush(bc_csv);
+        }
+    }
+    if (bc_csv) {
+        fprintf(bc_csv, "%u,%u,%zu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+            ack->height, ack->tx_count, ack->block_bytes,
+            (unsigned long)ack->t_recv_ns,
+            (unsigned long)ack->t_unpack_ns,
+            (unsigned long)ack->t_validate_ns,
+            (unsigned long)ack->t_commit_ns,
+            (unsigned long)t_send_ns,
+            (unsigned long)(t_send_ns - ack->t_recv_ns));
+        fflush(bc_csv);
+    }
+}
+#endif
+
+// Send every queued ack and notification, in acceptance order
+static void flush_block_acks(void* socket, void* metronome_push, void* pub_socket) {
+    for (uint32_t i = 0; i < pending_ack_count; i++) {
+        BlockAck* ack = &pending_acks[i];
+#ifndef DIAG_OFF
+        uint64_t t_send_ns = get_current_time_ns();
+#endif
+        send_to_peer(socket, ack->peer, ack->peer_len, "OK", 2);
+#ifndef DIAG_OFF
+        if (ack->block_bytes > 0) diag_log_block(ack, t_send_ns);
+#endif
+
+        // Notify metronome via PUSH
+        if (metronome_push && ack->farmer_name[0] != '\0') {
+            char notify_msg[256];
+            snprintf(notify_msg, sizeof(notify_msg),
+                     "BLOCK_CONFIRMED:%s|%s", ack->block_hash_hex, ack->farmer_name);
+            zmq_send(metronome_push, notify_msg, strlen(notify_msg), ZMQ_DONTWAIT);
+        }
+
+        if (pub_socket) {
+            // 1) NEW_BLOCK for wallets/benchmarks (text)
+            char pub_msg[256];
+            snprintf(pub_msg, sizeof(pub_msg), "NEW_BLOCK:%u:%u:%s",
+                     ack->height, ack->tx_count, ack->block_hash_hex);
+            zmq_send(pub_socket, pub_msg, strlen(pub_msg), ZMQ_DONTWAIT);
+
+            // 2) CONFIRM_BLOCK for pool TX removal (binary)
+            if (ack->confirm_msg) {
+                zmq_send(pub_socket, ack->confirm_msg, ack->confirm_len, ZMQ_DONTWAIT);
+                LOG_INFO("📤 PUB CONFIRM_BLOCK #%u (%u hashes)", ack->height, ack->confirm_count);
+            }
+        }
+        free(ack->confirm_msg);
+    }
+    pending_ack_count = 0;
+}
+
 int main(int argc, char* argv[]) {
     const char* bind_addr = "tcp://*:5555";
     const char* metronome_notify_addr = NULL;
     const char* pub_addr = NULL;
+    bool sequential_apply = false;
+    bool require_full_sigs = false;
+    const char* block_store_dir = NULL;
+    uint32_t hot_blocks = 0;
+    uint32_t sync_ms = BLOCKCHAIN_SYNC_MS;
+    uint32_t snapshot_every = BLOCKCHAIN_SNAPSHOT_BLOCKS;
     
     for (int i = 1; i < argc; i++) {
         if ((strcmp(argv[i], "--metronome-notify") == 0 || strcmp(argv[i], "-m") == 0) && i + 1 < argc) {
             metronome_notify_addr = argv[++i];
         } else if (strcmp(argv[i], "--pub") == 0 && i + 1 < argc) {
             pub_addr = argv[++i];
+        } else if (strcmp(argv[i], "--block-store") == 0 && i + 1 < argc) {
+            block_store_dir = argv[++i];
+        } else if (strcmp(argv[i], "--hot-blocks") == 0 && i + 1 < argc) {
+            hot_blocks = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--sync-ms") == 0 && i + 1 < argc) {
+            sync_ms = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--snapshot-every") == 0 && i + 1 < argc) {
+            snapshot_every = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--sequential-apply") == 0) {
+            sequential_apply = true;
+        } else if (strcmp(argv[i], "--require-full-sigs") == 0) {
+            require_full_sigs = true;
         } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
             printf("\nBlockchain Server v29.2\n");
             printf("Usage: %s [bind_addr] [options]\n", argv[0]);
             printf("  bind_addr                    REP socket (default: tcp://*:5555)\n");
             printf("  -m, --metronome-notify ADDR  PUSH to metronome\n");
             printf("  --pub ADDR                   PUB socket for block notifications\n");
+            printf("  --sequential-apply           Apply block TXs on one thread only\n");
+            printf("  --require-full-sigs          Reject blocks with TXs lacking a public key + full signature\n");
+            printf("  --block-store DIR            Keep blocks in segment files under DIR\n");
+            printf("  --hot-blocks N               Blocks kept in memory with --block-store (default: %d)\n",
+                   BLOCK_STORE_DEFAULT_HOT);
+            printf("  --sync-ms N                  Max age of an unsynced block with --block-store (default: %d)\n",
+                   BLOCKCHAIN_SYNC_MS);
+            printf("  --snapshot-every N           Ledger snapshot interval in blocks, 0 = off (default: %d)\n",
+                   BLOCKCHAIN_SNAPSHOT_BLOCKS);
             printf("  -h, --help                   Show this help\n\n");
             return 0;
         } else if (argv[i][0] != '-') {
@@ -69,22 +260,30 @@ int main(int argc, char* argv[]) {
     LOG_INFO("🔗 BLOCKCHAIN SERVER v29.2 (GET_LAST_HASH + PUB)");
     LOG_INFO("🔗 ════════════════════════════════════════════════════════════");
     LOG_INFO("   Commands: ADD_BLOCK, GET_LAST, GET_LAST_HASH, GET_HEIGHT,");
-    LOG_INFO("             GET_BALANCE, GET_NONCE, GET_SUMMARY");
+    LOG_INFO("             GET_BALANCE, GET_NONCE, GET_TX_PROOF, GET_SUMMARY, GET_STATUS");
     if (metronome_notify_addr)
         LOG_INFO("   Metronome PUSH: %s", metronome_notify_addr);
     if (pub_addr)
         LOG_INFO("   Block PUB:      %s", pub_addr);
     LOG_INFO("🔗 ════════════════════════════════════════════════════════════");
     
-    blockchain = blockchain_create();
+    // With a block store the chain is recovered from it (snapshot + tail)
+    blockchain = block_store_dir ? blockchain_open(block_store_dir, hot_blocks)
+                                 : blockchain_create();
     if (!blockchain) {
-        LOG_ERROR("❌ Failed to create blockchain");
+        if (block_store_dir)
+            LOG_ERROR("❌ Failed to open block store %s", block_store_dir);
+        else
+            LOG_ERROR("❌ Failed to create blockchain");
         return 1;
     }
+    blockchain_set_parallel_apply(blockchain, !sequential_apply);
+    blockchain_set_require_full_sigs(blockchain, require_full_sigs);
+    blockchain_set_persistence(blockchain, BLOCKCHAIN_SYNC_BLOCKS, sync_ms, snapshot_every);
     LOG_INFO("✅ Blockchain initialized (height: %lu)", blockchain->height);
     
     void* context = zmq_ctx_new();
-    void* socket = zmq_socket(context, ZMQ_REP);
+    void* socket = zmq_socket(context, ZMQ_ROUTER);   // REQ clients; see reply()
     
     if (zmq_bind(socket, bind_addr) != 0) {
         LOG_ERROR("❌ Failed to bind to %s", bind_addr);
@@ -136,7 +335,14 @@ int main(int argc, char* argv[]) {
     char* buffer = safe_malloc(BLOCKCHAIN_RECV_BUFFER_SIZE);
     
     while (running) {
-        int size = zmq_recv(socket, buffer, BLOCKCHAIN_RECV_BUFFER_SIZE - 1, 0);
+        // ROUTER framing: [peer identity][empty delimiter][request]
+        int size = -1;
+        reply_peer_len = zmq_recv(socket, reply_peer, sizeof(reply_peer), 0);
+        if (reply_peer_len > 0 &&
+            zmq_recv(socket, buffer, BLOCKCHAIN_RECV_BUFFER_SIZE - 1, 0) == 0)
+            size = zmq_recv(socket, buffer, BLOCKCHAIN_RECV_BUFFER_SIZE - 1, 0);
+        blockchain_sync_if_due(blockchain);
+        bool block_request = size > 0 && starts_with(buffer, "ADD_BLOCK");
         
         if (size > 0) {
             buffer[size] = '\0';
@@ -169,116 +375,29 @@ int main(int argc, char* argv[]) {
 #endif
 
                 if (block) {
-                    if (blockchain_add_block(blockchain, block)) {
+                    // The chain adopts the block: no copy, and it must not be freed here
+                    if (blockchain_adopt_block(blockchain, block, block_data, block_len)) {
                         LOG_INFO("✅ Block #%u added (height: %lu, %u TXs)",
                                  block->header.height, blockchain->height,
                                  block->header.transaction_count);
 #ifndef DIAG_OFF
-                        uint64_t blkd_t_validate_ns = bc_diag_t_validate_ns;
-                        uint64_t blkd_t_commit_ns   = bc_diag_t_commit_ns;
-                        uint64_t blkd_t_send_ns     = get_current_time_ns();
+                        BlockAck* ack = queue_block_ack(block, farmer_name);
+                        ack->block_bytes   = block_len;
+                        ack->t_recv_ns     = blkd_t_recv_ns;
+                        ack->t_unpack_ns   = blkd_t_unpack_ns;
+                        ack->t_validate_ns = bc_diag_t_validate_ns;
+                        ack->t_commit_ns   = bc_diag_t_commit_ns;
+#else
+                        queue_block_ack(block, farmer_name);
 #endif
-                        zmq_send(socket, "OK", 2, 0);
-#ifndef DIAG_OFF
-                        {
-                            static FILE* bc_csv = NULL;
-                            if (!bc_csv) {
-                                char csv_path[64];
-                                snprintf(csv_path, sizeof(csv_path),
-                                         "blockchain_diag_%d.csv", getpid());
-                                bc_csv = fopen(csv_path, "w");
-                                if (bc_csv) {
-                                    fprintf(bc_csv,
-                                        "block_height,block_txs,block_bytes,"
-                                        "t_recv_ns,t_unpack_ns,t_validate_ns,"
-                                        "t_commit_ns,t_send_ns,recv_to_send_ns\n");
-                                    fflush(bc_csv);
-                                }
-                            }
-                            if (bc_csv) {
-                                fprintf(bc_csv, "%u,%u,%zu,%lu,%lu,%lu,%lu,%lu,%lu\n",
-                                    block->header.height,
-                                    block->header.transaction_count,
-                                    block_len,
-                                    (unsigned long)blkd_t_recv_ns,
-                                    (unsigned long)blkd_t_unpack_ns,
-                                    (unsigned long)blkd_t_validate_ns,
-                                    (unsigned long)blkd_t_commit_ns,
-                                    (unsigned long)blkd_t_send_ns,
-                                    (unsigned long)(blkd_t_send_ns - blkd_t_recv_ns));
-                                fflush(bc_csv);
-                            }
-                        }
-#endif
-                        
-                        char block_hash_hex[65];
-                        bytes_to_hex_buf(block->header.hash, 32, block_hash_hex);
-                        
-                        // Notify metronome via PUSH
-                        if (metronome_push && farmer_name[0] != '\0') {
-                            char notify_msg[256];
-                            snprintf(notify_msg, sizeof(notify_msg),
-                                     "BLOCK_CONFIRMED:%s|%s", block_hash_hex, farmer_name);
-                            zmq_send(metronome_push, notify_msg, strlen(notify_msg), ZMQ_DONTWAIT);
-                        }
-                        
-                        if (pub_socket) {
-                            // 1) NEW_BLOCK for wallets/benchmarks (text)
-                            char pub_msg[256];
-                            snprintf(pub_msg, sizeof(pub_msg), "NEW_BLOCK:%u:%u:%s",
-                                     block->header.height, block->header.transaction_count,
-                                     block_hash_hex);
-                            zmq_send(pub_socket, pub_msg, strlen(pub_msg), ZMQ_DONTWAIT);
-                            
-                            // 2) CONFIRM_BLOCK for pool TX removal (binary)
-                            // =====================================================
-                            // THIS IS THE CORRECT CONFIRMATION PATH.
-                            // The blockchain has validated and accepted the block,
-                            // so these TXs are truly confirmed. Pool subscribes
-                            // to this PUB topic and removes them from pending.
-                            //
-                            // Format: "CONFIRM_BLOCK:" (14B) + height (4B) +
-                            //         hash_count (4B) + N x TX_HASH_SIZE hashes
-                            //
-                            // Skip index 0 (coinbase - not in pool).
-                            // =====================================================
-                            uint32_t user_tx_count = block->header.transaction_count > 1 
-                                ? block->header.transaction_count - 1 : 0;
-                            
-                            if (user_tx_count > 0) {
-                                size_t confirm_size = 22 + (size_t)user_tx_count * TX_HASH_SIZE;
-                                uint8_t* confirm_msg = safe_malloc(confirm_size);
-                                memcpy(confirm_msg, "CONFIRM_BLOCK:", 14);
-                                
-                                uint32_t height = block->header.height;
-                                memcpy(confirm_msg + 14, &height, 4);
-                                
-                                uint32_t hash_count = 0;
-                                uint8_t* hash_ptr = confirm_msg + 22;
-                                for (uint32_t ti = 1; ti <= user_tx_count; ti++) {
-                                    if (block->transactions[ti]) {
-                                        transaction_compute_hash(block->transactions[ti], hash_ptr);
-                                        hash_ptr += TX_HASH_SIZE;
-                                        hash_count++;
-                                    }
-                                }
-                                memcpy(confirm_msg + 18, &hash_count, 4);
-                                
-                                size_t actual_size = 22 + (size_t)hash_count * TX_HASH_SIZE;
-                                zmq_send(pub_socket, confirm_msg, actual_size, ZMQ_DONTWAIT);
-                                free(confirm_msg);
-                                
-                                LOG_INFO("📤 PUB CONFIRM_BLOCK #%u (%u hashes)", height, hash_count);
-                            }
-                        }
                     } else {
                         LOG_WARN("❌ Failed to add block #%u", block->header.height);
-                        zmq_send(socket, "FAIL", 4, 0);
+                        reply(socket, "FAIL", 4);
+                        block_destroy(block);
                     }
-                    block_destroy(block);
                 } else {
                     LOG_WARN("❌ Invalid protobuf block data (%zu bytes)", block_len);
-                    zmq_send(socket, "INVALID", 7, 0);
+                    reply(socket, "INVALID", 7);
                 }
                 
             }
@@ -300,61 +419,19 @@ int main(int argc, char* argv[]) {
                 
                 Block* block = block_deserialize(block_data);
                 if (block) {
-                    if (blockchain_add_block(blockchain, block)) {
+                    if (blockchain_adopt_block(blockchain, block, NULL, 0)) {
                         LOG_INFO("✅ Block #%u added (height: %lu, %u TXs)", 
                                  block->header.height, blockchain->height,
                                  block->header.transaction_count);
-                        zmq_send(socket, "OK", 2, 0);
-                        
-                        char block_hash_hex[65];
-                        bytes_to_hex_buf(block->header.hash, 32, block_hash_hex);
-                        
-                        if (metronome_push && farmer_name[0] != '\0') {
-                            char notify_msg[256];
-                            snprintf(notify_msg, sizeof(notify_msg),
-                                     "BLOCK_CONFIRMED:%s|%s", block_hash_hex, farmer_name);
-                            zmq_send(metronome_push, notify_msg, strlen(notify_msg), ZMQ_DONTWAIT);
-                        }
-                        
-                        if (pub_socket) {
-                            char pub_msg[256];
-                            snprintf(pub_msg, sizeof(pub_msg), "NEW_BLOCK:%u:%u:%s",
-                                     block->header.height, block->header.transaction_count,
-                                     block_hash_hex);
-                            zmq_send(pub_socket, pub_msg, strlen(pub_msg), ZMQ_DONTWAIT);
-                            
-                            // CONFIRM_BLOCK for pool (same as PB handler)
-                            uint32_t user_tx_count = block->header.transaction_count > 1 
-                                ? block->header.transaction_count - 1 : 0;
-                            if (user_tx_count > 0) {
-                                size_t confirm_size = 22 + (size_t)user_tx_count * TX_HASH_SIZE;
-                                uint8_t* confirm_msg = safe_malloc(confirm_size);
-                                memcpy(confirm_msg, "CONFIRM_BLOCK:", 14);
-                                uint32_t height = block->header.height;
-                                memcpy(confirm_msg + 14, &height, 4);
-                                uint32_t hash_count = 0;
-                                uint8_t* hash_ptr = confirm_msg + 22;
-                                for (uint32_t ti = 1; ti <= user_tx_count; ti++) {
-                                    if (block->transactions[ti]) {
-                                        transaction_compute_hash(block->transactions[ti], hash_ptr);
-                                        hash_ptr += TX_HASH_SIZE;
-                                        hash_count++;
-                                    }
-                                }
-                                memcpy(confirm_msg + 18, &hash_count, 4);
-                                size_t actual_size = 22 + (size_t)hash_count * TX_HASH_SIZE;
-                                zmq_send(pub_socket, confirm_msg, actual_size, ZMQ_DONTWAIT);
-                                free(confirm_msg);
-                            }
-                        }
+                        queue_block_ack(block, farmer_name);
                     } else {
                         LOG_WARN("❌ Failed to add block #%u", block->header.height);
-                        zmq_send(socket, "FAIL", 4, 0);
+                        reply(socket, "FAIL", 4);
+                        block_destroy(block);
                     }
-                    block_destroy(block);
                 } else {
                     LOG_WARN("❌ Invalid block data");
-                    zmq_send(socket, "INVALID", 7, 0);
+                    reply(socket, "INVALID", 7);
                 }
                 
             } else if (starts_with(buffer, "GET_LAST_HASH")) {
@@ -367,9 +444,9 @@ int main(int argc, char* argv[]) {
                 if (last) {
                     char hash_hex[65];
                     bytes_to_hex_buf(last->header.hash, 32, hash_hex);
-                    zmq_send(socket, hash_hex, 64, 0);
+                    reply(socket, hash_hex, 64);
                 } else {
-                    zmq_send(socket, "NONE", 4, 0);
+                    reply(socket, "NONE", 4);
                 }
                 
             } else if (starts_with(buffer, "GET_LAST")) {
@@ -377,16 +454,16 @@ int main(int argc, char* argv[]) {
                 Block* last = blockchain_get_last_block(blockchain);
                 if (last) {
                     char* hex = block_serialize(last);
-                    zmq_send(socket, hex, strlen(hex), 0);
+                    reply(socket, hex, strlen(hex));
                     free(hex);
                 } else {
-                    zmq_send(socket, "NONE", 4, 0);
+                    reply(socket, "NONE", 4);
                 }
                 
             } else if (starts_with(buffer, "GET_HEIGHT")) {
                 char resp[32];
                 snprintf(resp, sizeof(resp), "%lu", blockchain_get_height(blockchain));
-                zmq_send(socket, resp, strlen(resp), 0);
+                reply(socket, resp, strlen(resp));
                 
             } else if (starts_with(buffer, "FUND_WALLET:")) {
                 // ═══════════════════════════════════════════════════════
@@ -419,10 +496,10 @@ int main(int argc, char* argv[]) {
                     
                     char resp[128];
                     snprintf(resp, sizeof(resp), "FUNDED:%lu", amount);
-                    zmq_send(socket, resp, strlen(resp), 0);
+                    reply(socket, resp, strlen(resp));
                 } else {
                     LOG_WARN("FUND_WALLET: bad format (need 40-char hex address)");
-                    zmq_send(socket, "FAIL:PARSE", 10, 0);
+                    reply(socket, "FAIL:PARSE", 10);
                 }
                 
             } else if (starts_with(buffer, "GET_BALANCE:")) {
@@ -432,9 +509,9 @@ int main(int argc, char* argv[]) {
                     uint64_t balance = blockchain_get_balance(blockchain, addr);
                     char resp[32];
                     snprintf(resp, sizeof(resp), "%lu", balance);
-                    zmq_send(socket, resp, strlen(resp), 0);
+                    reply(socket, resp, strlen(resp));
                 } else {
-                    zmq_send(socket, "INVALID", 7, 0);
+                    reply(socket, "INVALID", 7);
                 }
                 
             // GET_BALANCES_BATCH - batch balance query (v45.3)
@@ -457,10 +534,10 @@ int main(int argc, char* argv[]) {
                         memcpy(resp + 8 + i * 8, &bal, 8);
                     }
                     
-                    zmq_send(socket, resp, resp_size, 0);
+                    reply(socket, resp, resp_size);
                     free(resp);
                 } else {
-                    zmq_send(socket, "INVALID", 7, 0);
+                    reply(socket, "INVALID", 7);
                 }
                 
             } else if (starts_with(buffer, "GET_NONCE:")) {
@@ -470,27 +547,87 @@ int main(int argc, char* argv[]) {
                     uint64_t nonce = blockchain_get_nonce(blockchain, addr);
                     char resp[32];
                     snprintf(resp, sizeof(resp), "%lu", nonce);
-                    zmq_send(socket, resp, strlen(resp), 0);
+                    reply(socket, resp, strlen(resp));
                 } else {
-                    zmq_send(socket, "INVALID", 7, 0);
+                    reply(socket, "INVALID", 7);
+                }
+                
+            // GET_TX_PROOF - Merkle inclusion proof for light wallets
+            // Request:  "GET_TX_PROOF:<height>:<tx_index>"
+            // Response: "PROOF:" (6B) + BlockHeader (200B) + index (4B) +
+            //           leaf_count (4B) + sibling_count (4B) + N×32B siblings
+            // Checked with block_verify_tx_proof() against the TX hash.
+            } else if (starts_with(buffer, "GET_TX_PROOF:")) {
+                unsigned long height = 0;
+                unsigned int index = 0;
+                Block* block = NULL;
+                MerkleProof proof;
+                if (sscanf(buffer + 13, "%lu:%u", &height, &index) == 2 &&
+                    (block = blockchain_get_block(blockchain, height)) != NULL &&
+                    block_tx_proof(block, index, &proof)) {
+                    size_t resp_size = 6 + sizeof(BlockHeader) + 12 +
+                                       (size_t)proof.sibling_count * MERKLE_HASH_SIZE;
+                    uint8_t resp[6 + sizeof(BlockHeader) + 12 + sizeof(proof.siblings)];
+                    uint8_t* p = resp;
+                    memcpy(p, "PROOF:", 6); p += 6;
+                    memcpy(p, &block->header, sizeof(BlockHeader)); p += sizeof(BlockHeader);
+                    memcpy(p, &proof.index, 4); p += 4;
+                    memcpy(p, &proof.leaf_count, 4); p += 4;
+                    memcpy(p, &proof.sibling_count, 4); p += 4;
+                    memcpy(p, proof.siblings, (size_t)proof.sibling_count * MERKLE_HASH_SIZE);
+                    reply(socket, resp, resp_size);
+                } else {
+                    reply(socket, "NOT_FOUND", 9);
                 }
                 
             } else if (starts_with(buffer, "GET_SUMMARY")) {
                 char resp[512];
                 snprintf(resp, sizeof(resp), "HEIGHT:%lu|ACCOUNTS:%u|REQUESTS:%lu",
                          blockchain->height, blockchain->ledger_count, requests_handled);
-                zmq_send(socket, resp, strlen(resp), 0);
+                reply(socket, resp, strlen(resp));
+                
+            } else if (starts_with(buffer, "GET_STATUS")) {
+                uint64_t sc_hits, sc_misses;
+                sig_cache_get_stats(&sc_hits, &sc_misses);
+                uint64_t sc_total = sc_hits + sc_misses;
+                char resp[256];
+                snprintf(resp, sizeof(resp),
+                         "HEIGHT:%lu|SIGCACHE_HITS:%lu|SIGCACHE_MISSES:%lu|SIGCACHE_HIT_RATE:%.1f"
+                         "|SIGS_CHECKED:%lu|SIGS_UNCHECKED:%lu",
+                         blockchain->height, sc_hits, sc_misses,
+                         sc_total ? 100.0 * sc_hits / sc_total : 0.0,
+                         blockchain->sigs_checked, blockchain->sigs_unchecked);
+                reply(socket, resp, strlen(resp));
                 
             } else {
                 LOG_WARN("❓ Unknown: %.20s...", buffer);
-                zmq_send(socket, "UNKNOWN", 7, 0);
+                reply(socket, "UNKNOWN", 7);
             }
         }
+
+        // No further block to batch into the open group: sync it now rather
+        // than holding its acks until the age limit. Snapshots also run only
+        // here, between requests, never inside an ADD_BLOCK.
+        if (!block_request) {
+            if (blockchain->unsynced_blocks > 0 && pending_ack_count > 0)
+                blockchain_sync(blockchain);
+            else if (pending_ack_count == 0)
+                blockchain_snapshot_if_due(blockchain);
+        }
+        if (pending_ack_count > 0 && blockchain->unsynced_blocks == 0)
+            flush_block_acks(socket, metronome_push, pub_socket);
     }
     
     free(buffer);
     LOG_INFO("💾 Saving blockchain...");
-    blockchain_save_pb(blockchain, "blockchain.dat");
+    if (blockchain->store)
+        blockchain_snapshot(blockchain);
+    else
+        blockchain_save_pb(blockchain, "blockchain.dat");
+    if (blockchain->unsynced_blocks == 0)
+        flush_block_acks(socket, metronome_push, pub_socket);
+    for (uint32_t i = 0; i < pending_ack_count; i++) free(pending_acks[i].confirm_msg);
+    free(pending_acks);
     LOG_INFO("📊 Final: %lu blocks, %u accounts, %lu requests",
              blockchain->height, blockchain->ledger_count, requests_handled);
     
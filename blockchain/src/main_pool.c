@@ -28,6 +28,18 @@
  *  │     Wallets also subscribe to the same PUB channel.                    │
  *  └─────────────────────────────────────────────────────────────────────────┘
  *
+ * ADMISSION VERIFY (--verify-admission):
+ *     SUBMIT_BATCH_PB batches are signature-checked in parallel (OpenMP
+ *     slices over transaction_verify_batch) before pool_add. Bad signatures
+ *     count as rejected in the "OK:accepted|rejected" reply. Accepted TXs
+ *     are flagged pre-verified and GET_FOR_WINNER answers with TXTV (TXTS
+ *     plus one flag byte per TX) so the validator can skip its sig phase.
+ *
+ * FEE PRIORITY (--fee-priority):
+ *     GET_FOR_WINNER selects by fee per byte (heap of sender nonce chains)
+ *     instead of address order, so high-fee TXs from late senders are not
+ *     starved. Replies stay grouped by sender with nonces in order.
+ *
  * SERIALIZATION: Google Protocol Buffers (protobuf) for all data paths.
  * TRANSPORT:     ZeroMQ (REP for requests, SUB for blockchain notifications)
  *
@@ -37,6 +49,7 @@
 #include "../include/transaction_pool.h"
 #include "../include/transaction.h"
 #include "../include/crypto_backend.h"
+#include "../include/sig_cache.h"
 #include "../include/common.h"
 #include "../proto/blockchain.pb-c.h"
 #include <stdlib.h>
@@ -44,12 +57,17 @@
 #include <string.h>
 #include <signal.h>
 #include <zmq.h>
+#include <omp.h>
 
 static volatile bool running = true;
 static TransactionPool* pool = NULL;
+static TxArena* fetch_arena = NULL;        // GET_FOR_WINNER views, reset per fetch
 static uint64_t total_submitted = 0;
 static uint64_t total_confirmed = 0;
 static uint64_t total_rejected = 0;
+static uint64_t total_sig_rejected = 0;
+static bool admission_verify = false;
+static bool fee_priority = false;
 
 void signal_handler(int sig) {
     (void)sig;
@@ -90,6 +108,23 @@ static Transaction* pb_to_transaction(const Blockchain__Transaction* pt) {
     return tx;
 }
 
+/**
+ * Admission verify stage: check all signatures of a submitted batch in
+ * parallel. Each OpenMP thread verifies one contiguous slice (wallet batches
+ * are grouped by sender, so per-key setup is shared within a slice).
+ */
+static void verify_admission_batch(Transaction** txs, uint32_t count, uint8_t* valid) {
+    #pragma omp parallel
+    {
+        uint32_t nth = (uint32_t)omp_get_num_threads();
+        uint32_t tid = (uint32_t)omp_get_thread_num();
+        uint32_t lo = (uint32_t)((uint64_t)count * tid / nth);
+        uint32_t hi = (uint32_t)((uint64_t)count * (tid + 1) / nth);
+        if (hi > lo)
+            transaction_verify_batch(&txs[lo], hi - lo, &valid[lo]);
+    }
+}
+
 int main(int argc, char* argv[]) {
     const char* bind_addr = "tcp://*:5557";
     const char* blockchain_pub_addr = NULL;  // SUB socket for confirmations
@@ -101,6 +136,10 @@ int main(int argc, char* argv[]) {
             blockchain_pub_addr = argv[++i];
         } else if (strcmp(argv[i], "--pub") == 0 && i + 1 < argc) {
             pool_pub_addr = argv[++i];
+        } else if (strcmp(argv[i], "--verify-admission") == 0) {
+            admission_verify = true;
+        } else if (strcmp(argv[i], "--fee-priority") == 0) {
+            fee_priority = true;
         } else if (argv[i][0] != '-') {
             bind_addr = argv[i];
         }
@@ -114,6 +153,9 @@ int main(int argc, char* argv[]) {
     LOG_INFO("🏊 ════════════════════════════════════════════════════════════");
     LOG_INFO("   Data format:  Google Protocol Buffers (protobuf)");
     LOG_INFO("   Confirm via:  Blockchain PUB/SUB (async, not validator)");
+    if (admission_verify)
+        LOG_INFO("   Admission:    signatures verified on submit (%d threads)",
+                 omp_get_max_threads());
     LOG_INFO("   REP commands:");
     LOG_INFO("     SUBMIT_BATCH_PB:<pb>  - Submit batch (protobuf)");
     LOG_INFO("     SUBMIT_BATCH:<hex>    - Submit batch (hex, legacy)");
@@ -132,6 +174,11 @@ int main(int argc, char* argv[]) {
     }
     LOG_INFO("✅ Transaction pool initialized (capacity: %d, max: %d)", 
              pool->capacity, MAX_POOL_SIZE);
+    fetch_arena = tx_arena_create(0);
+    if (fee_priority) {
+        pool_set_select_mode(pool, POOL_SELECT_FEE_PRIORITY);
+        LOG_INFO("   Selection:    fee per byte (sender nonce chains)");
+    }
     
     // ═══════════════════════════════════════════════════════════════════
     // ZMQ SOCKET SETUP
@@ -232,25 +279,46 @@ int main(int argc, char* argv[]) {
                         blockchain__transaction_batch__unpack(
                             NULL, size - 16, (uint8_t*)(buffer + 16));
                     
-                    int accepted = 0, rejected = 0;
-                    if (batch) {
-                        for (size_t i = 0; i < batch->n_transactions; i++) {
-                            Transaction* tx = pb_to_transaction(batch->transactions[i]);
-                            if (pool_add(pool, tx)) {
+                    int accepted = 0, rejected = 0, sig_rejected = 0;
+                    if (batch && batch->n_transactions > 0) {
+                        uint32_t n = (uint32_t)batch->n_transactions;
+                        Transaction** txs = safe_malloc(n * sizeof(Transaction*));
+                        for (uint32_t i = 0; i < n; i++)
+                            txs[i] = pb_to_transaction(batch->transactions[i]);
+                        
+                        uint8_t* valid = NULL;
+                        if (admission_verify) {
+                            valid = safe_malloc(n);
+                            verify_admission_batch(txs, n, valid);
+                        }
+                        
+                        for (uint32_t i = 0; i < n; i++) {
+                            bool added;
+                            if (valid && !valid[i]) {
+                                sig_rejected++;
+                                added = false;
+                            } else {
+                                added = valid ? pool_add_preverified(pool, txs[i])
+                                              : pool_add(pool, txs[i]);
+                            }
+                            if (added) {
                                 accepted++;
                                 total_submitted++;
                             } else {
                                 rejected++;
                                 total_rejected++;
                             }
-                            transaction_destroy(tx);
+                            transaction_destroy(txs[i]);
                         }
-                        blockchain__transaction_batch__free_unpacked(batch, NULL);
+                        total_sig_rejected += sig_rejected;
+                        free(valid);
+                        free(txs);
                     }
+                    if (batch) blockchain__transaction_batch__free_unpacked(batch, NULL);
                     
                     if (accepted >= 100 || rejected > 0) {
-                        LOG_INFO("BATCH_PB: +%d -%d (pending: %u)", 
-                                 accepted, rejected, pool->pending_count);
+                        LOG_INFO("BATCH_PB: +%d -%d (bad sig: %d, pending: %u)", 
+                                 accepted, rejected, sig_rejected, pool->pending_count);
                     }
                     
                     char resp[64];
@@ -343,9 +411,11 @@ int main(int argc, char* argv[]) {
                     uint8_t* pubkeys = NULL;
                     uint64_t* t0_ns = NULL;
                     uint64_t* t1_ns = NULL;
-                    Transaction** txs = pool_get_pending_with_pubkeys(
-                        pool, max_count, block_height, &count, &pubkeys,
-                        &t0_ns, &t1_ns);
+                    uint8_t* preverified = NULL;
+                    tx_arena_reset(fetch_arena);
+                    TxView** txs = pool_get_pending_with_pubkeys(
+                        pool, fetch_arena, max_count, block_height, &count, &pubkeys,
+                        &t0_ns, &t1_ns, admission_verify ? &preverified : NULL);
                     uint64_t scan_duration_ns = get_current_time_ns() - scan_start;
 
                     if (scan_duration_ns > 100000000ULL)
@@ -368,7 +438,7 @@ int main(int argc, char* argv[]) {
                         for (uint32_t i = 0; i < count; i++) {
                             Blockchain__Transaction* pt = &pb_arr[i];
                             blockchain__transaction__init(pt);
-                            // Zero-copy: point into packed Transaction struct
+                            // Zero-copy: point into the TxView records in fetch_arena
                             pt->nonce = txs[i]->nonce;
                             pt->expiry_block = txs[i]->expiry_block;
                             pt->source_address.data = txs[i]->source_address;
@@ -379,16 +449,12 @@ int main(int argc, char* argv[]) {
                             pt->fee = txs[i]->fee;
                             // Signature: use actual sig_len (supports PQC variable-length sigs)
                             if (txs[i]->sig_len > 0) {
-                                pt->signature.data = txs[i]->signature;
+                                pt->signature.data = tx_view_signature(txs[i]);
                                 pt->signature.len = txs[i]->sig_len;
-                            } else if (!is_zero(txs[i]->signature, 64)) {
-                                // Fallback: Ed25519 with no sig_len set
-                                pt->signature.data = txs[i]->signature;
-                                pt->signature.len = 64;
                             }
                             // Pubkey: TX carries it inline (v47 design, supports PQC variable-length)
                             if (txs[i]->pubkey_len > 0) {
-                                pt->public_key.data = txs[i]->public_key;
+                                pt->public_key.data = tx_view_public_key(txs[i]);
                                 pt->public_key.len = txs[i]->pubkey_len;
                             }
                             pt->sig_type = txs[i]->sig_type;
@@ -401,15 +467,20 @@ int main(int argc, char* argv[]) {
                     uint64_t pack_start = get_current_time_ns();
                     size_t pb_size = blockchain__transaction_batch__get_packed_size(&batch);
                     // TXTS format: "TXTS"(4) + count(4) + t0_ns[count](count*8) + t1_ns[count](count*8) + pb
-                    size_t ts_hdr  = 4 + 4 + (size_t)count * 16;
+                    // TXTV format: as TXTS with preverified[count](count*1) before pb
+                    size_t ts_hdr  = 4 + 4 + (size_t)count * (admission_verify ? 17 : 16);
                     size_t resp_size = ts_hdr + pb_size;
                     uint8_t* response = safe_malloc(resp_size);
-                    memcpy(response, "TXTS", 4);
+                    memcpy(response, admission_verify ? "TXTV" : "TXTS", 4);
                     memcpy(response + 4, &count, 4);
                     if (count > 0 && t0_ns) memcpy(response + 8,             t0_ns, count * 8);
                     else if (count > 0)     memset(response + 8, 0, count * 8);
                     if (count > 0 && t1_ns) memcpy(response + 8 + count * 8, t1_ns, count * 8);
                     else if (count > 0)     memset(response + 8 + count * 8, 0, count * 8);
+                    if (admission_verify && count > 0) {
+                        if (preverified) memcpy(response + 8 + count * 16, preverified, count);
+                        else             memset(response + 8 + count * 16, 0, count);
+                    }
                     blockchain__transaction_batch__pack(&batch, response + ts_hdr);
                     uint64_t pack_duration_ns = get_current_time_ns() - pack_start;
 
@@ -442,14 +513,13 @@ int main(int argc, char* argv[]) {
                              (unsigned long)(pack_duration_ns / 1000000ULL));
                     zmq_send(rep_socket, response, resp_size, 0);
                     
-                    // Cleanup (AFTER pack - zero-copy pointers must stay valid during pack)
-                    for (uint32_t i = 0; i < count; i++) {
-                        transaction_destroy(txs[i]);
-                    }
+                    // Cleanup (AFTER pack - zero-copy pointers must stay valid during pack).
+                    // The views themselves go with the next tx_arena_reset().
                     if (txs) free(txs);
                     if (pubkeys) free(pubkeys);
                     if (t0_ns) free(t0_ns);
                     if (t1_ns) free(t1_ns);
+                    if (preverified) free(preverified);
                     if (pb_ptrs) free(pb_ptrs);
                     if (pb_arr) free(pb_arr);
                     free(response);
@@ -546,12 +616,19 @@ int main(int argc, char* argv[]) {
                 else if (strcmp(buffer, "GET_STATUS") == 0) {
                     uint32_t pending, confirmed;
                     pool_get_stats(pool, &pending, &confirmed);
+                    uint64_t sc_hits, sc_misses;
+                    sig_cache_get_stats(&sc_hits, &sc_misses);
+                    uint64_t sc_total = sc_hits + sc_misses;
                     
-                    char resp[256];
+                    char resp[384];
                     snprintf(resp, sizeof(resp), 
-                             "PENDING:%u|CONFIRMED:%u|TOTAL:%u|CAPACITY:%u|SUBMITTED:%lu|REJECTED:%lu",
+                             "PENDING:%u|CONFIRMED:%u|TOTAL:%u|CAPACITY:%u|SUBMITTED:%lu|REJECTED:%lu"
+                             "|SIG_REJECTED:%lu"
+                             "|SIGCACHE_HITS:%lu|SIGCACHE_MISSES:%lu|SIGCACHE_HIT_RATE:%.1f",
                              pending, confirmed, pool->count, pool->capacity, 
-                             total_submitted, total_rejected);
+                             total_submitted, total_rejected, total_sig_rejected,
+                             sc_hits, sc_misses,
+                             sc_total ? 100.0 * sc_hits / sc_total : 0.0);
                     zmq_send(rep_socket, resp, strlen(resp), 0);
                 }
                 else {
@@ -624,6 +701,11 @@ int main(int argc, char* argv[]) {
     
     free(buffer);
     free(sub_buffer);
+    if (admission_verify) {
+        #pragma omp parallel
+        crypto_thread_cleanup();
+    }
+    tx_arena_destroy(fetch_arena);
     pool_destroy(pool);
     zmq_close(rep_socket);
     if (sub_socket) zmq_close(sub_socket);
@@ -64,6 +64,20 @@ void print_usage(const char* prog) {
     printf("  --pool <addr>             Pool address (default: tcp://localhost:5557)\n");
     printf("  --blockchain <addr>       Blockchain (default: tcp://localhost:5555)\n");
     printf("  --max-txs <N>             Max transactions per block (default: 10000)\n");
+    printf("  --full-sigs               Send full signatures + public keys in blocks\n");
+    printf("                            (lets the blockchain re-verify every TX)\n");
+    printf("  --trust-pool-verify       Skip sig check for TXs the pool verified at\n");
+    printf("                            admission (pool --verify-admission)\n");
+    printf("  --generate-plot-only      Generate (and save) the plot, then exit\n");
+    printf("  --threads <N>             Plot generation threads (default: all cores)\n");
+    printf("  --plot-load <mode>        Saved plot loading: mmap (default), populate,\n");
+    printf("                            random (mmap + MADV_RANDOM) or heap\n");
+    printf("  --compact-plot            Generate a compact plot (12 instead of 32 bytes\n");
+    printf("                            per entry; hashes recomputed when searching)\n");
+    printf("  --plot-memory <MB>        Stream the plot to plots_persistent/ using at\n");
+    printf("                            most <MB> of RAM (for plots larger than memory)\n");
+    printf("  --plot-dir <dir>          Farm every *.plot file in <dir> instead of the\n");
+    printf("                            wallet's own plot (searched in parallel)\n");
     printf("  -h, --help                Show this help\n");
     printf("\n");
 }
@@ -76,6 +90,7 @@ int main(int argc, char* argv[]) {
     const char* pool_addr = "tcp://localhost:5557";
     const char* blockchain_addr = "tcp://localhost:5555";
     const char* name = NULL;
+    const char* plot_dir = NULL;
     uint8_t sig_type = SIG_SCHEME;  // default from compile-time flag
 
     static struct option long_options[] = {
@@ -87,10 +102,18 @@ int main(int argc, char* argv[]) {
         {"blockchain", required_argument, 0, 4},
         {"max-txs", required_argument, 0, 5},
         {"generate-plot-only", no_argument, 0, 7},
+        {"full-sigs", no_argument, 0, 8},
+        {"trust-pool-verify", no_argument, 0, 9},
+        {"threads", required_argument, 0, 10},
+        {"plot-load", required_argument, 0, 11},
+        {"compact-plot", no_argument, 0, 12},
+        {"plot-dir", required_argument, 0, 13},
+        {"plot-memory", required_argument, 0, 14},
         {"help", no_argument, 0, 'h'},
         {0, 0, 0, 0}
     };
     bool generate_plot_only = false;
+    bool trust_pool_verify = false;
 
     int opt;
     while ((opt = getopt_long(argc, argv, "k:h", long_options, NULL)) != -1) {
@@ -109,6 +132,19 @@ int main(int argc, char* argv[]) {
             case 4: blockchain_addr = optarg; break;
             case 5: max_txs = atoi(optarg); break;
             case 7: generate_plot_only = true; break;
+            case 8: block_set_pb_full_signatures(true); break;
+            case 9: trust_pool_verify = true; break;
+            case 10: plot_set_threads((uint32_t)atoi(optarg)); break;
+            case 11:
+                if (strcmp(optarg, "mmap") == 0) plot_set_load_mode(PLOT_LOAD_MMAP);
+                else if (strcmp(optarg, "populate") == 0) plot_set_load_mode(PLOT_LOAD_POPULATE);
+                else if (strcmp(optarg, "random") == 0) plot_set_load_mode(PLOT_LOAD_RANDOM);
+                else if (strcmp(optarg, "heap") == 0) plot_set_load_mode(PLOT_LOAD_HEAP);
+                else { fprintf(stderr, "Unknown plot load mode: %s\n", optarg); return 1; }
+                break;
+            case 12: plot_set_compact(true); break;
+            case 13: plot_dir = optarg; break;
+            case 14: plot_set_memory_limit(strtoull(optarg, NULL, 10) << 20); break;
             case 'h':
                 print_usage(argv[0]);
                 return 0;
@@ -138,6 +174,7 @@ int main(int argc, char* argv[]) {
     LOG_INFO("  Metronome SUB:    %s (for challenges + winner)", metronome_sub);
     LOG_INFO("  Pool:             %s (for TX fetching when winner)", pool_addr);
     LOG_INFO("  Blockchain:       %s (for block submission when winner)", blockchain_addr);
+    LOG_INFO("  Plot threads:     %u", plot_get_threads());
     LOG_INFO("  Architecture:     Proof → Winner? → Block → Blockchain → Notify");
     
     validator = validator_create(name, k_param, sig_type);
@@ -155,11 +192,20 @@ int main(int argc, char* argv[]) {
         }
     }
     
-    LOG_INFO("Generating plot...");
-    if (!validator_generate_plot(validator)) {
-        LOG_ERROR("Failed to generate plot");
-        validator_destroy(validator);
-        return 1;
+    if (plot_dir && !generate_plot_only) {
+        LOG_INFO("Loading plots from %s...", plot_dir);
+        if (!validator_load_plot_dir(validator, plot_dir)) {
+            LOG_ERROR("No usable plots in %s", plot_dir);
+            validator_destroy(validator);
+            return 1;
+        }
+    } else {
+        LOG_INFO("Generating plot...");
+        if (!validator_generate_plot(validator)) {
+            LOG_ERROR("Failed to generate plot");
+            validator_destroy(validator);
+            return 1;
+        }
     }
     
     if (generate_plot_only) {
@@ -174,6 +220,9 @@ int main(int argc, char* argv[]) {
     if (max_txs > 0) {
         validator_set_max_txs_per_block(max_txs);
     }
+    if (trust_pool_verify) {
+        validator_set_trust_pool_verify(true);
+    }
     
     validator_run(validator);
     
@@ -0,0 +1,229 @@
+#include "../include/merkle.h"
+#include "../include/common.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MERKLE_LEAF_TAG      0x00
+#define MERKLE_NODE_TAG      0x01
+#define MERKLE_MIN_CAPACITY  16
+#define MERKLE_HASH_BATCH    16          // Nodes per blake3_hash_many() call
+
+static inline void hash_pair(const uint8_t left[MERKLE_HASH_SIZE],
+                             const uint8_t right[MERKLE_HASH_SIZE],
+                             uint8_t out[MERKLE_HASH_SIZE]) {
+    uint8_t buf[1 + 2 * MERKLE_HASH_SIZE];
+    buf[0] = MERKLE_NODE_TAG;
+    memcpy(buf + 1, left, MERKLE_HASH_SIZE);
+    memcpy(buf + 1 + MERKLE_HASH_SIZE, right, MERKLE_HASH_SIZE);
+    blake3_hash(buf, sizeof(buf), out);
+}
+
+void merkle_leaf_hash(const uint8_t tx_hash[TX_HASH_SIZE], uint8_t out[MERKLE_HASH_SIZE]) {
+    uint8_t buf[1 + TX_HASH_SIZE];
+    buf[0] = MERKLE_LEAF_TAG;
+    memcpy(buf + 1, tx_hash, TX_HASH_SIZE);
+    blake3_hash(buf, sizeof(buf), out);
+}
+
+void merkle_leaf_hash_many(const uint8_t* tx_hashes, uint32_t count, uint8_t* out) {
+    uint8_t buffers[MERKLE_HASH_BATCH][1 + TX_HASH_SIZE];
+    const uint8_t* inputs[MERKLE_HASH_BATCH];
+
+    for (uint32_t first = 0; first < count; first += MERKLE_HASH_BATCH) {
+        uint32_t n = count - first < MERKLE_HASH_BATCH ? count - first : MERKLE_HASH_BATCH;
+        for (uint32_t j = 0; j < n; j++) {
+            buffers[j][0] = MERKLE_LEAF_TAG;
+            memcpy(buffers[j] + 1, tx_hashes + (size_t)(first + j) * TX_HASH_SIZE, TX_HASH_SIZE);
+            inputs[j] = buffers[j];
+        }
+        blake3_hash_many(inputs, n, sizeof(buffers[0]),
+                         out + (size_t)first * MERKLE_HASH_SIZE, MERKLE_HASH_SIZE);
+    }
+}
+
+// Parents first .. first + count - 1 of a level, all of which have two children
+static void hash_pairs(uint8_t (*below)[MERKLE_HASH_SIZE], uint8_t (*above)[MERKLE_HASH_SIZE],
+                       uint32_t first, uint32_t count) {
+    uint8_t buffers[MERKLE_HASH_BATCH][1 + 2 * MERKLE_HASH_SIZE];
+    const uint8_t* inputs[MERKLE_HASH_BATCH];
+
+    for (uint32_t j = 0; j < count; j++) {
+        buffers[j][0] = MERKLE_NODE_TAG;
+        memcpy(buffers[j] + 1, below[2 * (first + j)], 2 * MERKLE_HASH_SIZE);
+        inputs[j] = buffers[j];
+    }
+    blake3_hash_many(inputs, count, sizeof(buffers[0]), above[first], MERKLE_HASH_SIZE);
+}
+
+// =============================================================================
+// TREE
+// =============================================================================
+
+MerkleTree* merkle_create(void) {
+    MerkleTree* tree = safe_malloc(sizeof(MerkleTree));
+    memset(tree, 0, sizeof(MerkleTree));
+    return tree;
+}
+
+void merkle_destroy(MerkleTree* tree) {
+    if (!tree) return;
+    for (uint32_t l = 0; l < MERKLE_MAX_LEVELS; l++) free(tree->nodes[l]);
+    free(tree);
+}
+
+void merkle_resize(MerkleTree* tree, uint32_t count) {
+    if (!tree) return;
+
+    if (count > tree->capacity) {
+        // Doubling for one-by-one appends, exact for a whole block at once
+        uint32_t capacity = tree->capacity ? tree->capacity * 2 : MERKLE_MIN_CAPACITY;
+        if (capacity < count || capacity < tree->capacity) capacity = count;
+
+        // Every level is sized for the new capacity; contents are kept
+        uint32_t size = capacity;
+        for (uint32_t l = 0; l < MERKLE_MAX_LEVELS; l++) {
+            tree->nodes[l] = safe_realloc(tree->nodes[l], (size_t)size * MERKLE_HASH_SIZE);
+            if (size == 1) break;
+            size = (size + 1) / 2;
+        }
+        tree->capacity = capacity;
+    }
+
+    // Growing gives the old last node a sibling; shrinking may take one away.
+    // Either way the path from the new edge is recomputed.
+    uint32_t edge = count < tree->leaf_count ? (count > 0 ? count - 1 : 0) : tree->leaf_count;
+    if (edge < tree->dirty_from) tree->dirty_from = edge;
+    tree->leaf_count = count;
+}
+
+uint8_t* merkle_leaf(MerkleTree* tree, uint32_t index) {
+    if (!tree || index >= tree->leaf_count) return NULL;
+    return tree->nodes[0][index];
+}
+
+void merkle_leaf_changed(MerkleTree* tree, uint32_t index) {
+    if (!tree || index >= tree->leaf_count || index >= tree->dirty_from) return;
+    if (tree->dirty_from < tree->leaf_count) {
+        tree->dirty_from = index;
+        return;
+    }
+
+    uint32_t j = index;
+    uint32_t size = tree->leaf_count;
+    for (uint32_t level = 0; size > 1; level++) {
+        uint8_t (*below)[MERKLE_HASH_SIZE] = tree->nodes[level];
+        uint32_t left = j & ~1u;
+        if (left + 1 < size)
+            hash_pair(below[left], below[left + 1], tree->nodes[level + 1][j >> 1]);
+        else
+            memcpy(tree->nodes[level + 1][j >> 1], below[left], MERKLE_HASH_SIZE);
+        j >>= 1;
+        size = (size + 1) / 2;
+    }
+}
+
+void merkle_root(MerkleTree* tree, uint8_t root[MERKLE_HASH_SIZE]) {
+    uint32_t n = tree ? tree->leaf_count : 0;
+    if (n == 0) {
+        memset(root, 0, MERKLE_HASH_SIZE);
+        if (tree) tree->levels = 0;
+        return;
+    }
+
+    if (tree->dirty_from >= n && tree->levels > 0) {
+        memcpy(root, tree->nodes[tree->levels - 1][0], MERKLE_HASH_SIZE);
+        return;
+    }
+
+    // Level by level, only from the parent of the first dirty node rightwards
+    uint32_t level = 0;
+    uint32_t size = n;
+    while (size > 1) {
+        uint8_t (*below)[MERKLE_HASH_SIZE] = tree->nodes[level];
+        uint8_t (*above)[MERKLE_HASH_SIZE] = tree->nodes[level + 1];
+        uint32_t parents = (size + 1) / 2;
+        uint32_t start = tree->dirty_from >> (level + 1);
+        if (start > parents) start = parents;
+
+        // Full pairs in batches for the SIMD hasher; an odd last node is promoted
+        uint32_t pairs = size / 2;
+        if (start < pairs) {
+            uint32_t batches = (pairs - start + MERKLE_HASH_BATCH - 1) / MERKLE_HASH_BATCH;
+            #pragma omp parallel for schedule(static) if (pairs - start >= MERKLE_PARALLEL_MIN)
+            for (uint32_t b = 0; b < batches; b++) {
+                uint32_t first = start + b * MERKLE_HASH_BATCH;
+                uint32_t n = pairs - first < MERKLE_HASH_BATCH ? pairs - first : MERKLE_HASH_BATCH;
+                hash_pairs(below, above, first, n);
+            }
+        }
+        if (pairs < parents && start < parents)
+            memcpy(above[pairs], below[2 * pairs], MERKLE_HASH_SIZE);
+
+        size = parents;
+        level++;
+    }
+
+    tree->levels = level + 1;
+    tree->dirty_from = n;
+    memcpy(root, tree->nodes[level][0], MERKLE_HASH_SIZE);
+}
+
+bool merkle_cached_root(const MerkleTree* tree, uint8_t root[MERKLE_HASH_SIZE]) {
+    if (!tree || tree->leaf_count == 0 || tree->levels == 0 ||
+        tree->dirty_from < tree->leaf_count) return false;
+    memcpy(root, tree->nodes[tree->levels - 1][0], MERKLE_HASH_SIZE);
+    return true;
+}
+
+// =============================================================================
+// INCLUSION PROOFS
+// =============================================================================
+
+bool merkle_proof(const MerkleTree* tree, uint32_t index, MerkleProof* proof) {
+    if (!tree || !proof || index >= tree->leaf_count) return false;
+    if (tree->dirty_from < tree->leaf_count) return false;   // merkle_root first
+
+    memset(proof, 0, sizeof(MerkleProof));
+    proof->index = index;
+    proof->leaf_count = tree->leaf_count;
+
+    uint32_t j = index;
+    uint32_t size = tree->leaf_count;
+    for (uint32_t level = 0; size > 1; level++) {
+        uint32_t sibling = j ^ 1;
+        if (sibling < size)
+            memcpy(proof->siblings[proof->sibling_count++], tree->nodes[level][sibling],
+                   MERKLE_HASH_SIZE);
+        j >>= 1;
+        size = (size + 1) / 2;
+    }
+    return true;
+}
+
+bool merkle_proof_root(const uint8_t tx_hash[TX_HASH_SIZE], const MerkleProof* proof,
+                       uint8_t root[MERKLE_HASH_SIZE]) {
+    if (!tx_hash || !proof || proof->index >= proof->leaf_count ||
+        proof->sibling_count > MERKLE_MAX_LEVELS) return false;
+
+    uint8_t node[MERKLE_HASH_SIZE];
+    merkle_leaf_hash(tx_hash, node);
+
+    uint32_t used = 0;
+    uint32_t j = proof->index;
+    uint32_t size = proof->leaf_count;
+    while (size > 1) {
+        uint32_t sibling = j ^ 1;
+        if (sibling < size) {
+            if (used == proof->sibling_count) return false;
+            const uint8_t* s = proof->siblings[used++];
+            if (j & 1) hash_pair(s, node, node);
+            else       hash_pair(node, s, node);
+        }
+        j >>= 1;
+        size = (size + 1) / 2;
+    }
+    if (used != proof->sibling_count) return false;
+
+    memcpy(root, node, MERKLE_HASH_SIZE);
+    return true;
+}
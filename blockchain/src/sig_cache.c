@@ -0,0 +1,103 @@
+#include "../include/sig_cache.h"
+#include "../include/common.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+// =============================================================================
+// Verified-signature cache — sharded, direct-mapped
+// =============================================================================
+//
+// tx_hash is a BLAKE3 output, so its first 8 bytes are uniformly distributed
+// and select both the shard and the slot directly (no extra hashing).
+// The slot array is allocated on first use so processes that never verify
+// (metronome, wallet) pay nothing.
+// =============================================================================
+
+#define SIG_CACHE_SHARDS      64
+#define SIG_CACHE_SLOTS_PER   (SIG_CACHE_ENTRIES / SIG_CACHE_SHARDS)
+
+typedef struct {
+    SigCacheKey key;
+    uint8_t used;
+} SigCacheSlot;
+
+typedef struct {
+    pthread_mutex_t lock;
+    SigCacheSlot* slots;
+} SigCacheShard;
+
+static SigCacheShard shards[SIG_CACHE_SHARDS];
+static pthread_once_t cache_once = PTHREAD_ONCE_INIT;
+static uint64_t cache_hits = 0;
+static uint64_t cache_misses = 0;
+
+static void sig_cache_init(void) {
+    for (int i = 0; i < SIG_CACHE_SHARDS; i++) {
+        pthread_mutex_init(&shards[i].lock, NULL);
+        shards[i].slots = safe_malloc(SIG_CACHE_SLOTS_PER * sizeof(SigCacheSlot));
+        memset(shards[i].slots, 0, SIG_CACHE_SLOTS_PER * sizeof(SigCacheSlot));
+    }
+}
+
+static SigCacheSlot* locate(const SigCacheKey* key, SigCacheShard** shard_out) {
+    pthread_once(&cache_once, sig_cache_init);
+    uint64_t h;
+    memcpy(&h, key->tx_hash, sizeof(h));
+    SigCacheShard* shard = &shards[h % SIG_CACHE_SHARDS];
+    *shard_out = shard;
+    return &shard->slots[(h / SIG_CACHE_SHARDS) % SIG_CACHE_SLOTS_PER];
+}
+
+void sig_cache_make_key_raw(uint8_t sig_type,
+                            const uint8_t* sig, size_t sig_len,
+                            const uint8_t* pubkey, size_t pubkey_len,
+                            const uint8_t tx_hash[TX_HASH_SIZE], SigCacheKey* key) {
+    // Lengths are hashed so (sig, pubkey) boundaries cannot be shifted
+    uint32_t sig_len32 = (uint32_t)sig_len;
+    uint32_t pubkey_len32 = (uint32_t)pubkey_len;
+
+    blake3_hasher hasher;
+    blake3_hasher_init(&hasher);
+    blake3_hasher_update(&hasher, &sig_type, 1);
+    blake3_hasher_update(&hasher, &sig_len32, 4);
+    blake3_hasher_update(&hasher, &pubkey_len32, 4);
+    blake3_hasher_update(&hasher, sig, sig_len);
+    blake3_hasher_update(&hasher, pubkey, pubkey_len);
+    blake3_hasher_finalize(&hasher, key->sig_digest, 32);
+
+    memcpy(key->tx_hash, tx_hash, TX_HASH_SIZE);
+}
+
+void sig_cache_make_key(const Transaction* tx, const uint8_t tx_hash[TX_HASH_SIZE],
+                        SigCacheKey* key) {
+    sig_cache_make_key_raw(tx->sig_type, tx->signature, tx->sig_len,
+                           tx->public_key, tx->pubkey_len, tx_hash, key);
+}
+
+bool sig_cache_contains(const SigCacheKey* key) {
+    SigCacheShard* shard;
+    SigCacheSlot* slot = locate(key, &shard);
+
+    pthread_mutex_lock(&shard->lock);
+    bool hit = slot->used && memcmp(&slot->key, key, sizeof(SigCacheKey)) == 0;
+    pthread_mutex_unlock(&shard->lock);
+
+    __atomic_fetch_add(hit ? &cache_hits : &cache_misses, 1, __ATOMIC_RELAXED);
+    return hit;
+}
+
+void sig_cache_insert(const SigCacheKey* key) {
+    SigCacheShard* shard;
+    SigCacheSlot* slot = locate(key, &shard);
+
+    pthread_mutex_lock(&shard->lock);
+    memcpy(&slot->key, key, sizeof(SigCacheKey));
+    slot->used = 1;
+    pthread_mutex_unlock(&shard->lock);
+}
+
+void sig_cache_get_stats(uint64_t* hits, uint64_t* misses) {
+    if (hits) *hits = __atomic_load_n(&cache_hits, __ATOMIC_RELAXED);
+    if (misses) *misses = __atomic_load_n(&cache_misses, __ATOMIC_RELAXED);
+}
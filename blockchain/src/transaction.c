@@ -8,6 +8,8 @@
 #include "../include/transaction.h"
 #include "../include/wallet.h"
 #include "../include/common.h"
+#include "../include/sig_cache.h"
+#include "../include/tx_arena.h"
 #include "../proto/blockchain.pb-c.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -100,18 +102,58 @@ Transaction* transaction_create_coinbase(const uint8_t farmer_address[20],
 //   - BLAKE3 is used (not SHA256) for consistency with the Proof-of-Space
 //     plot hashes, keeping a single hash dependency in the codebase.
 //
+// Works on Transaction and TxView alike (same economic field names)
+#define TX_HASH_INPUT_SIZE (8 + 4 + 20 + 20 + 8 + 4)  /* 64 bytes */
+
+#define TX_HASH_INPUT(tx, buffer) do {                                  \
+    size_t offset = 0;                                                  \
+    memcpy((buffer) + offset, &(tx)->nonce, 8); offset += 8;            \
+    memcpy((buffer) + offset, &(tx)->expiry_block, 4); offset += 4;     \
+    memcpy((buffer) + offset, (tx)->source_address, 20); offset += 20;  \
+    memcpy((buffer) + offset, (tx)->dest_address, 20); offset += 20;    \
+    memcpy((buffer) + offset, &(tx)->value, 8); offset += 8;            \
+    memcpy((buffer) + offset, &(tx)->fee, 4);                           \
+} while (0)
+
+#define TX_HASH_FIELDS(tx, hash) do {                                   \
+    uint8_t buffer[TX_HASH_INPUT_SIZE];                                 \
+    TX_HASH_INPUT(tx, buffer);                                          \
+    blake3_hash_truncated(buffer, sizeof(buffer), (hash), TX_HASH_SIZE); \
+} while (0)
+
+// TXs hashed per blake3_hash_many() call (widest SIMD kernel)
+#define TX_HASH_BATCH 16
+
 void transaction_compute_hash(const Transaction* tx, uint8_t hash[TX_HASH_SIZE]) {
-    uint8_t buffer[8 + 4 + 20 + 20 + 8 + 4];  // 64 bytes
-    size_t offset = 0;
+    TX_HASH_FIELDS(tx, hash);
+}
 
-    memcpy(buffer + offset, &tx->nonce, 8); offset += 8;
-    memcpy(buffer + offset, &tx->expiry_block, 4); offset += 4;
-    memcpy(buffer + offset, tx->source_address, 20); offset += 20;
-    memcpy(buffer + offset, tx->dest_address, 20); offset += 20;
-    memcpy(buffer + offset, &tx->value, 8); offset += 8;
-    memcpy(buffer + offset, &tx->fee, 4); offset += 4;
+void tx_view_compute_hash(const TxView* tx, uint8_t hash[TX_HASH_SIZE]) {
+    TX_HASH_FIELDS(tx, hash);
+}
 
-    blake3_hash_truncated(buffer, sizeof(buffer), hash, TX_HASH_SIZE);
+void tx_view_compute_hash_many(const TxView* const* txs, uint32_t count, uint8_t* hashes) {
+    uint8_t buffers[TX_HASH_BATCH][TX_HASH_INPUT_SIZE];
+    const uint8_t* inputs[TX_HASH_BATCH];
+    uint32_t slot[TX_HASH_BATCH];
+    uint8_t out[TX_HASH_BATCH][TX_HASH_SIZE];
+
+    for (uint32_t first = 0; first < count; first += TX_HASH_BATCH) {
+        uint32_t end = count - first < TX_HASH_BATCH ? count : first + TX_HASH_BATCH;
+        uint32_t n = 0;
+        for (uint32_t i = first; i < end; i++) {
+            if (!txs[i]) {
+                memset(hashes + (size_t)i * TX_HASH_SIZE, 0, TX_HASH_SIZE);
+                continue;
+            }
+            TX_HASH_INPUT(txs[i], buffers[n]);
+            inputs[n] = buffers[n];
+            slot[n++] = i;
+        }
+        blake3_hash_many(inputs, n, TX_HASH_INPUT_SIZE, out[0], TX_HASH_SIZE);
+        for (uint32_t j = 0; j < n; j++)
+            memcpy(hashes + (size_t)slot[j] * TX_HASH_SIZE, out[j], TX_HASH_SIZE);
+    }
 }
 
 char* transaction_get_hash_hex(const Transaction* tx) {
@@ -152,9 +194,138 @@ bool transaction_verify(const Transaction* tx) {
     uint8_t tx_hash[TX_HASH_SIZE];
     transaction_compute_hash(tx, tx_hash);
 
-    return crypto_verify_typed(tx->sig_type, tx->signature, tx->sig_len,
-                               tx_hash, TX_HASH_SIZE,
-                               tx->public_key, tx->pubkey_len);
+    // Already verified by this process (retry after deadline / partial block)
+    SigCacheKey key;
+    sig_cache_make_key(tx, tx_hash, &key);
+    if (sig_cache_contains(&key)) return true;
+
+    bool ok = crypto_verify_typed(tx->sig_type, tx->signature, tx->sig_len,
+                                  tx_hash, TX_HASH_SIZE,
+                                  tx->public_key, tx->pubkey_len);
+    if (ok) sig_cache_insert(&key);
+    return ok;
+}
+
+// Shared body of transaction_verify_batch() / tx_view_verify_batch():
+// callers resolve NULL, unsigned and coinbase items, then queue the rest.
+typedef struct {
+    SigCacheKey* keys;
+    uint8_t* hashes;
+    uint8_t* sig_types;
+    const uint8_t** sigs;
+    const uint8_t** msgs;
+    const uint8_t** pubkeys;
+    size_t* sig_lens;
+    size_t* msg_lens;
+    size_t* pubkey_lens;
+    uint32_t* slot;
+    uint8_t* batch_results;
+    uint32_t n;
+} VerifyQueue;
+
+static void verify_queue_init(VerifyQueue* q, uint32_t count) {
+    q->keys = safe_malloc(count * sizeof(SigCacheKey));
+    q->hashes = safe_malloc((size_t)count * TX_HASH_SIZE);
+    q->sig_types = safe_malloc(count);
+    q->sigs = safe_malloc(count * sizeof(uint8_t*));
+    q->msgs = safe_malloc(count * sizeof(uint8_t*));
+    q->pubkeys = safe_malloc(count * sizeof(uint8_t*));
+    q->sig_lens = safe_malloc(count * sizeof(size_t));
+    q->msg_lens = safe_malloc(count * sizeof(size_t));
+    q->pubkey_lens = safe_malloc(count * sizeof(size_t));
+    q->slot = safe_malloc(count * sizeof(uint32_t));
+    q->batch_results = safe_malloc(count);
+    q->n = 0;
+}
+
+// hash must be q->hashes + q->n * TX_HASH_SIZE; sig-cache hits pass directly
+static void verify_queue_push(VerifyQueue* q, uint32_t i, uint8_t sig_type,
+                              const uint8_t* sig, size_t sig_len,
+                              const uint8_t* pubkey, size_t pubkey_len,
+                              uint8_t* results) {
+    uint32_t n = q->n;
+    const uint8_t* hash = q->hashes + (size_t)n * TX_HASH_SIZE;
+    sig_cache_make_key_raw(sig_type, sig, sig_len, pubkey, pubkey_len, hash, &q->keys[n]);
+    if (sig_cache_contains(&q->keys[n])) { results[i] = 1; return; }
+
+    q->sig_types[n] = sig_type;
+    q->sigs[n] = sig;
+    q->sig_lens[n] = sig_len;
+    q->msgs[n] = hash;
+    q->msg_lens[n] = TX_HASH_SIZE;
+    q->pubkeys[n] = pubkey;
+    q->pubkey_lens[n] = pubkey_len;
+    q->slot[n] = i;
+    q->n = n + 1;
+}
+
+static bool verify_queue_run(VerifyQueue* q, uint8_t* results) {
+    bool ok = true;
+    if (q->n > 0 && !crypto_verify_many(q->sig_types, q->sigs, q->sig_lens,
+                                        q->msgs, q->msg_lens,
+                                        q->pubkeys, q->pubkey_lens,
+                                        q->n, q->batch_results))
+        ok = false;
+    for (uint32_t j = 0; j < q->n; j++) {
+        results[q->slot[j]] = q->batch_results[j];
+        if (q->batch_results[j]) sig_cache_insert(&q->keys[j]);
+    }
+
+    free(q->keys); free(q->hashes); free(q->sig_types); free(q->sigs); free(q->msgs);
+    free(q->pubkeys); free(q->sig_lens); free(q->msg_lens); free(q->pubkey_lens);
+    free(q->slot); free(q->batch_results);
+    return ok;
+}
+
+bool transaction_verify_batch(Transaction* const* txs, uint32_t count, uint8_t* results) {
+    if (count == 0) return true;
+
+    // Same rules as transaction_verify(): NULL / unsigned TXs fail, coinbase
+    // passes without a signature, sig-cache hits pass. Everything else goes
+    // to one batch call.
+    VerifyQueue q;
+    verify_queue_init(&q, count);
+
+    bool all_ok = true;
+    for (uint32_t i = 0; i < count; i++) {
+        const Transaction* tx = txs[i];
+        if (!tx || (!TX_IS_COINBASE(tx) && (tx->sig_len == 0 || tx->pubkey_len == 0))) {
+            results[i] = 0;
+            all_ok = false;
+            continue;
+        }
+        if (TX_IS_COINBASE(tx)) { results[i] = 1; continue; }
+
+        transaction_compute_hash(tx, q.hashes + (size_t)q.n * TX_HASH_SIZE);
+        verify_queue_push(&q, i, tx->sig_type, tx->signature, tx->sig_len,
+                          tx->public_key, tx->pubkey_len, results);
+    }
+
+    return verify_queue_run(&q, results) && all_ok;
+}
+
+bool tx_view_verify_batch(TxView* const* txs, uint32_t count, uint8_t* results) {
+    if (count == 0) return true;
+
+    VerifyQueue q;
+    verify_queue_init(&q, count);
+
+    bool all_ok = true;
+    for (uint32_t i = 0; i < count; i++) {
+        const TxView* tx = txs[i];
+        if (!tx || (!TX_IS_COINBASE(tx) && (tx->sig_len == 0 || tx->pubkey_len == 0))) {
+            results[i] = 0;
+            all_ok = false;
+            continue;
+        }
+        if (TX_IS_COINBASE(tx)) { results[i] = 1; continue; }
+
+        tx_view_compute_hash(tx, q.hashes + (size_t)q.n * TX_HASH_SIZE);
+        verify_queue_push(&q, i, tx->sig_type, tx_view_signature(tx), tx->sig_len,
+                          tx_view_public_key(tx), tx->pubkey_len, results);
+    }
+
+    return verify_queue_run(&q, results) && all_ok;
 }
 
 bool transaction_is_expired(const Transaction* tx, uint32_t current_block_height) {
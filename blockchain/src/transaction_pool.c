@@ -5,32 +5,448 @@
 #include <string.h>
 
 // =============================================================================
-// v47: Transaction Pool — Simplified (No Hash Table)
+// Transaction Pool — compact entries + slab arena + tx_hash index
 // =============================================================================
 //
-// DESIGN: Pool is a simple, fast buffer. No duplicate detection. No hash table.
+// DESIGN: Pool is a simple, fast buffer. Duplicate TXs from different senders'
+// nonces are still the validator's problem; the pool only rejects a TX whose
+// tx_hash it already holds.
 //
-// WHY NO HASH TABLE:
-//   1. Nonces already guarantee uniqueness per sender. Duplicate TXs (same
-//      sender + same nonce) are rejected by the validator during block creation.
-//   2. In distributed mode, duplicates arrive from different nodes — no single
-//      pool can detect them all. Validators must handle duplicates regardless.
-//   3. Removing the hash table saves 16MB RAM, eliminates tombstone compaction,
-//      and simplifies the entire pool to ~200 lines.
+// WHY AN INDEX (again):
+//   The v47 assigned-list confirm was O(K) on the happy path, but every miss
+//   (TX served in an earlier round, or by another pool) fell back to a scan of
+//   all 1.1M entries, so a 65K-TX CONFIRM_BLOCK could cost ~10^10 compares.
+//   The index has no tombstones (backward-shift delete), so the compaction
+//   problem that got the v29 table removed does not come back.
 //
-// CONFIRMATION:
-//   Instead of hash-based lookup (O(1) but requires hash table + tombstones),
-//   we track which entries were assigned to the last block via assigned_indices[].
-//   On CONFIRM_BLOCK, we scan only the assigned list (O(K) where K = block size).
-//   This is typically K = 10,000 — a linear scan takes <0.1ms.
+// WHY COMPACT ENTRIES:
+//   The old PoolEntry embedded a 1312-byte pubkey and pointed at a malloc'd
+//   ~3.8 KB Transaction, so 1.1M slots reserved ~1.5 GB up front and every
+//   scan strided 1.4 KB per entry. Entries are now 64 bytes (70 MB for 1.1M);
+//   signatures take only their real length in the arena, and a sender's
+//   pubkey is stored once no matter how many of its TXs are pooled.
+//
+// WHY QUEUES + ORDERED SENDERS:
+//   GET_FOR_WINNER used to scan all 1.1M slots, copy every pending TX and
+//   qsort by (address, nonce) each round. The order is now maintained as TXs
+//   arrive: each sender keeps its TXs linked in nonce order, and senders sit
+//   in a treap keyed by address. A fetch walks the treap in order and follows
+//   each queue, so K TXs cost O(K + log S) with no sort and no empty slots.
 //
 // PERFORMANCE:
-//   pool_add:         O(1) — free list pop, no hash computation, no duplicate check
-//   pool_get_pending: O(n) scan + O(n log n) sort — same as before
-//   pool_confirm:     O(K) scan of assigned list — was O(1) but K is small
+//   pool_add:         O(1) — free list pop + one index probe (dup check);
+//                     queue insert is O(1) for in-order nonces, new sender
+//                     O(log S) treap insert
+//   pool_get_pending: O(K + log S) for K TXs from S senders (address order);
+//                     O(S + K log S) in fee-priority mode (heap of chains)
+//   pool_confirm:     O(1) — index probe; batch confirm prefetches ahead
+//   pool_contains:    O(1)
 // =============================================================================
 
 #define INITIAL_POOL_CAPACITY 1100000
+#define HASH_INDEX_NOT_FOUND  UINT32_MAX
+#define CONFIRM_PREFETCH_DIST 8       // hashes probed ahead in pool_confirm_batch
+#define POOL_SENDERS_INITIAL  4096
+
+_Static_assert(sizeof(PoolEntry) == 64, "PoolEntry must stay one cache line");
+
+// ---- tx_hash index ----
+//
+// tx_hash is a BLAKE3 output: bytes 0..7 pick the home slot, bytes 8..11 are
+// the tag stored next to the entry index so mismatches rarely touch entries[].
+
+static inline uint32_t index_home(const TransactionPool* pool, const uint8_t* tx_hash) {
+    uint64_t h;
+    memcpy(&h, tx_hash, sizeof(h));
+    return (uint32_t)h & pool->hash_index_mask;
+}
+
+static inline uint32_t index_tag(const uint8_t* tx_hash) {
+    uint32_t t;
+    memcpy(&t, tx_hash + 8, sizeof(t));
+    return t;
+}
+
+// Returns the SLOT holding tx_hash, or HASH_INDEX_NOT_FOUND
+static uint32_t index_find(const TransactionPool* pool, const uint8_t* tx_hash) {
+    uint32_t tag = index_tag(tx_hash);
+    uint32_t s = index_home(pool, tx_hash);
+    for (;;) {
+        uint64_t v = pool->hash_index[s];
+        if (v == 0) return HASH_INDEX_NOT_FOUND;
+        if ((uint32_t)(v >> 32) == tag) {
+            uint32_t idx = (uint32_t)v - 1;
+            if (memcmp(pool->entries[idx].tx_hash, tx_hash, TX_HASH_SIZE) == 0) return s;
+        }
+        s = (s + 1) & pool->hash_index_mask;
+    }
+}
+
+static void index_insert(TransactionPool* pool, uint32_t entry_idx) {
+    const uint8_t* tx_hash = pool->entries[entry_idx].tx_hash;
+    uint32_t s = index_home(pool, tx_hash);
+    while (pool->hash_index[s] != 0) s = (s + 1) & pool->hash_index_mask;
+    pool->hash_index[s] = ((uint64_t)index_tag(tx_hash) << 32) | (entry_idx + 1);
+}
+
+// Backward-shift deletion: pull later members of the probe run into the hole
+// so lookups never need tombstones.
+static void index_remove_slot(TransactionPool* pool, uint32_t hole) {
+    uint32_t mask = pool->hash_index_mask;
+    uint32_t j = hole;
+    for (;;) {
+        j = (j + 1) & mask;
+        uint64_t v = pool->hash_index[j];
+        if (v == 0) break;
+        uint32_t home = index_home(pool, pool->entries[(uint32_t)v - 1].tx_hash);
+        // Leave v where it is if its home lies cyclically in (hole, j]
+        bool stays = hole <= j ? (home > hole && home <= j)
+                               : (home > hole || home <= j);
+        if (stays) continue;
+        pool->hash_index[hole] = v;
+        hole = j;
+    }
+    pool->hash_index[hole] = 0;
+}
+
+// ---- Slab arena ----
+//
+// Bump allocation into POOL_SLAB_SIZE slabs. Nothing is freed individually;
+// each slab counts its live allocations and is rewound once that reaches 0.
+// A few long-lived allocations (a TX with no expiry, a sender's pubkey) would
+// keep a whole slab each, so when the current slab is full and none is
+// drained, the emptiest slab is compacted in place if at most a quarter of
+// it is live. New slabs are only added while every slab is over 1/4 live.
+
+static inline uint8_t* arena_ptr(const TransactionPool* pool, PoolRef ref) {
+    return pool->slabs[ref >> 32].data + (uint32_t)ref;
+}
+
+static inline uint32_t arena_size(size_t size) {
+    return (uint32_t)((size + 7) & ~(size_t)7);
+}
+
+typedef struct {
+    PoolRef* ref;                          // owner's reference (entry body, pubkey)
+    uint32_t size;
+} ArenaOwner;
+
+static int arena_owner_compare(const void* a, const void* b) {
+    uint32_t x = (uint32_t)*((const ArenaOwner*)a)->ref;
+    uint32_t y = (uint32_t)*((const ArenaOwner*)b)->ref;
+    return (x > y) - (x < y);
+}
+
+// Slide slab s's live allocations down to its start, in offset order, and
+// repoint their owners. The owners are found by scanning in-use entries and
+// live senders: O(capacity), once per POOL_SLAB_SIZE * 3/4 bytes allocated.
+static bool arena_compact(TransactionPool* pool, uint32_t s) {
+    PoolSlab* slab = &pool->slabs[s];
+    ArenaOwner* owners = safe_malloc(((size_t)slab->live + 1) * sizeof(ArenaOwner));
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < pool->capacity && n <= slab->live; i++) {
+        PoolEntry* e = &pool->entries[i];
+        if (e->in_use && (e->body >> 32) == s) {
+            owners[n].ref = &e->body;
+            owners[n++].size = arena_size(sizeof(PoolTxBody) + e->sig_len);
+        }
+    }
+    for (uint32_t i = 0; i < pool->sender_count && n <= slab->live; i++) {
+        PoolSender* snd = &pool->senders[i];
+        if (snd->refs > 0 && snd->pubkey_len > 0 && (snd->pubkey >> 32) == s) {
+            owners[n].ref = &snd->pubkey;
+            owners[n++].size = arena_size(snd->pubkey_len);
+        }
+    }
+    if (n != slab->live) {
+        LOG_ERROR("Pool arena: slab %u has %u live allocations, found %u", s, slab->live, n);
+        free(owners);
+        return false;
+    }
+
+    qsort(owners, n, sizeof(ArenaOwner), arena_owner_compare);
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t from = (uint32_t)*owners[i].ref;
+        if (from != offset) memmove(slab->data + offset, slab->data + from, owners[i].size);
+        *owners[i].ref = ((PoolRef)s << 32) | offset;
+        offset += owners[i].size;
+    }
+    slab->used = offset;
+    slab->live_bytes = offset;
+    free(owners);
+    return true;
+}
+
+static PoolRef arena_alloc(TransactionPool* pool, size_t size) {
+    uint32_t bytes = arena_size(size);
+    PoolSlab* cur = pool->slab_count ? &pool->slabs[pool->cur_slab] : NULL;
+
+    if (!cur || cur->used + bytes > POOL_SLAB_SIZE) {
+        // Reuse a drained slab, else compact the emptiest one, else grow
+        uint32_t next = pool->slab_count;
+        uint32_t sparse = pool->slab_count;
+        for (uint32_t i = 0; i < pool->slab_count; i++) {
+            if (pool->slabs[i].live == 0) { next = i; break; }
+            if (sparse == pool->slab_count ||
+                pool->slabs[i].live_bytes < pool->slabs[sparse].live_bytes) sparse = i;
+        }
+        if (next == pool->slab_count && sparse < pool->slab_count &&
+            pool->slabs[sparse].live_bytes <= POOL_SLAB_SIZE / 4 &&
+            arena_compact(pool, sparse)) {
+            pool->cur_slab = sparse;
+            cur = &pool->slabs[sparse];
+        } else {
+            if (next == pool->slab_count) {
+                if (pool->slab_count == pool->slab_capacity) {
+                    pool->slab_capacity = pool->slab_capacity ? pool->slab_capacity * 2 : 8;
+                    pool->slabs = realloc(pool->slabs, pool->slab_capacity * sizeof(PoolSlab));
+                    if (!pool->slabs) {
+                        LOG_ERROR("Pool arena: out of memory");
+                        exit(1);
+                    }
+                }
+                pool->slabs[next].data = safe_malloc(POOL_SLAB_SIZE);
+                pool->slab_count++;
+            }
+            pool->slabs[next].used = 0;
+            pool->slabs[next].live = 0;
+            pool->slabs[next].live_bytes = 0;
+            pool->cur_slab = next;
+            cur = &pool->slabs[next];
+        }
+    }
+
+    PoolRef ref = ((PoolRef)pool->cur_slab << 32) | cur->used;
+    cur->used += bytes;
+    cur->live++;
+    cur->live_bytes += bytes;
+    return ref;
+}
+
+static void arena_release(TransactionPool* pool, PoolRef ref, size_t size) {
+    PoolSlab* slab = &pool->slabs[ref >> 32];
+    slab->live_bytes -= arena_size(size);
+    if (--slab->live == 0) slab->used = 0;
+}
+
+// ---- Ordered sender index (treap) ----
+//
+// BST on (address, sender id), heap on a random order_prio, so the expected
+// depth is O(log S) whatever addresses arrive. Only senders with at least one
+// pooled TX are in the tree (membership follows refs > 0).
+
+static inline PoolSender* order_node(const TransactionPool* pool, uint32_t ref) {
+    return &pool->senders[ref - 1];
+}
+
+static inline bool order_less(const TransactionPool* pool, uint32_t a, uint32_t b) {
+    int c = memcmp(pool->senders[a].address, pool->senders[b].address, 20);
+    return c < 0 || (c == 0 && a < b);
+}
+
+static uint32_t order_rotate_right(TransactionPool* pool, uint32_t root) {
+    uint32_t l = order_node(pool, root)->order_left;
+    order_node(pool, root)->order_left = order_node(pool, l)->order_right;
+    order_node(pool, l)->order_right = root;
+    return l;
+}
+
+static uint32_t order_rotate_left(TransactionPool* pool, uint32_t root) {
+    uint32_t r = order_node(pool, root)->order_right;
+    order_node(pool, root)->order_right = order_node(pool, r)->order_left;
+    order_node(pool, r)->order_left = root;
+    return r;
+}
+
+static uint32_t order_insert(TransactionPool* pool, uint32_t root, uint32_t id) {
+    if (root == 0) return id + 1;
+    PoolSender* node = order_node(pool, root);
+    if (order_less(pool, id, root - 1)) {
+        node->order_left = order_insert(pool, node->order_left, id);
+        if (order_node(pool, node->order_left)->order_prio > node->order_prio)
+            root = order_rotate_right(pool, root);
+    } else {
+        node->order_right = order_insert(pool, node->order_right, id);
+        if (order_node(pool, node->order_right)->order_prio > node->order_prio)
+            root = order_rotate_left(pool, root);
+    }
+    return root;
+}
+
+static uint32_t order_remove(TransactionPool* pool, uint32_t root, uint32_t id) {
+    if (root == 0) return 0;
+    PoolSender* node = order_node(pool, root);
+    if (root - 1 == id) {
+        // Rotate the node down towards a leaf, then unlink it
+        if (node->order_left == 0) return node->order_right;
+        if (node->order_right == 0) return node->order_left;
+        uint32_t top;
+        if (order_node(pool, node->order_left)->order_prio >
+            order_node(pool, node->order_right)->order_prio) {
+            top = order_rotate_right(pool, root);
+            order_node(pool, top)->order_right = order_remove(pool, order_node(pool, top)->order_right, id);
+        } else {
+            top = order_rotate_left(pool, root);
+            order_node(pool, top)->order_left = order_remove(pool, order_node(pool, top)->order_left, id);
+        }
+        return top;
+    }
+    if (order_less(pool, id, root - 1))
+        node->order_left = order_remove(pool, node->order_left, id);
+    else
+        node->order_right = order_remove(pool, node->order_right, id);
+    return root;
+}
+
+static uint32_t order_next_prio(TransactionPool* pool) {
+    uint64_t x = pool->order_rng;
+    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+    pool->order_rng = x;
+    return (uint32_t)(x >> 32);
+}
+
+// ---- Per-sender nonce queues ----
+//
+// Wallets submit nonces in increasing order, so the insert point is almost
+// always the tail; an out-of-order TX walks back from the tail.
+
+static void queue_insert(TransactionPool* pool, uint32_t sender, uint32_t idx) {
+    PoolSender* snd = &pool->senders[sender];
+    PoolLink* links = pool->queue_links;
+    uint64_t nonce = pool->entries[idx].nonce;
+
+    uint32_t after = snd->queue_tail;
+    while (after != 0 && pool->entries[after - 1].nonce > nonce)
+        after = links[after - 1].prev;
+
+    links[idx].prev = after;
+    links[idx].next = after ? links[after - 1].next : snd->queue_head;
+    if (links[idx].next) links[links[idx].next - 1].prev = idx + 1;
+    else snd->queue_tail = idx + 1;
+    if (after) links[after - 1].next = idx + 1;
+    else snd->queue_head = idx + 1;
+}
+
+static void queue_unlink(TransactionPool* pool, uint32_t sender, uint32_t idx) {
+    PoolSender* snd = &pool->senders[sender];
+    PoolLink* link = &pool->queue_links[idx];
+    if (link->prev) pool->queue_links[link->prev - 1].next = link->next;
+    else snd->queue_head = link->next;
+    if (link->next) pool->queue_links[link->next - 1].prev = link->prev;
+    else snd->queue_tail = link->prev;
+}
+
+// ---- Senders (pubkey dedup) ----
+//
+// Keyed by (address, pubkey): a TX whose pubkey differs from the one already
+// stored for its address gets its own record, so a bogus key submitted first
+// can never be attached to another TX from the same address.
+
+static inline uint32_t sender_home(const TransactionPool* pool, const uint8_t address[20]) {
+    uint64_t a, b;
+    memcpy(&a, address, 8);
+    memcpy(&b, address + 12, 8);
+    return (uint32_t)(((a ^ b) * 0x9E3779B97F4A7C15ULL) >> 32) & pool->sender_index_mask;
+}
+
+static uint32_t sender_acquire(TransactionPool* pool, const uint8_t address[20],
+                               const uint8_t* pubkey, size_t pubkey_len) {
+    uint32_t s = sender_home(pool, address);
+    for (;;) {
+        uint32_t v = pool->sender_index[s];
+        if (v == 0) break;
+        PoolSender* snd = &pool->senders[v - 1];
+        if (memcmp(snd->address, address, 20) == 0 && snd->pubkey_len == pubkey_len &&
+            (pubkey_len == 0 || memcmp(arena_ptr(pool, snd->pubkey), pubkey, pubkey_len) == 0)) {
+            snd->refs++;
+            return v - 1;
+        }
+        s = (s + 1) & pool->sender_index_mask;
+    }
+
+    uint32_t id;
+    if (pool->sender_free_count > 0) {
+        id = pool->sender_free[--pool->sender_free_count];
+    } else {
+        if (pool->sender_count == pool->sender_capacity) {
+            uint32_t new_cap = pool->sender_capacity * 2;
+            PoolSender* ns = realloc(pool->senders, new_cap * sizeof(PoolSender));
+            uint32_t* nf = realloc(pool->sender_free, new_cap * sizeof(uint32_t));
+            if (!ns || !nf) {
+                LOG_ERROR("Pool senders: out of memory");
+                exit(1);
+            }
+            pool->senders = ns;
+            pool->sender_free = nf;
+            pool->sender_capacity = new_cap;
+        }
+        id = pool->sender_count++;
+    }
+
+    // Not live (refs 0) until the pubkey is in place: arena_alloc may compact
+    PoolSender* snd = &pool->senders[id];
+    snd->refs = 0;
+    snd->pubkey = 0;
+    if (pubkey_len > 0) {
+        snd->pubkey = arena_alloc(pool, pubkey_len);
+        memcpy(arena_ptr(pool, snd->pubkey), pubkey, pubkey_len);
+    }
+    memcpy(snd->address, address, 20);
+    snd->pubkey_len = (uint16_t)pubkey_len;
+    snd->refs = 1;
+    snd->queue_head = snd->queue_tail = 0;
+    snd->order_left = snd->order_right = 0;
+    snd->order_prio = order_next_prio(pool);
+    pool->sender_index[s] = id + 1;
+    pool->order_root = order_insert(pool, pool->order_root, id);
+    return id;
+}
+
+static void sender_release(TransactionPool* pool, uint32_t id) {
+    PoolSender* snd = &pool->senders[id];
+    if (--snd->refs > 0) return;
+
+    pool->order_root = order_remove(pool, pool->order_root, id);
+    if (snd->pubkey_len > 0) arena_release(pool, snd->pubkey, snd->pubkey_len);
+
+    // Find our slot, then backward-shift delete (same scheme as the tx index)
+    uint32_t mask = pool->sender_index_mask;
+    uint32_t hole = sender_home(pool, snd->address);
+    while (pool->sender_index[hole] != id + 1) hole = (hole + 1) & mask;
+    uint32_t j = hole;
+    for (;;) {
+        j = (j + 1) & mask;
+        uint32_t v = pool->sender_index[j];
+        if (v == 0) break;
+        uint32_t home = sender_home(pool, pool->senders[v - 1].address);
+        bool stays = hole <= j ? (home > hole && home <= j)
+                               : (home > hole || home <= j);
+        if (stays) continue;
+        pool->sender_index[hole] = v;
+        hole = j;
+    }
+    pool->sender_index[hole] = 0;
+
+    pool->sender_free[pool->sender_free_count++] = id;
+}
+
+// Drop entry idx (indexed at slot) from the pool. Caller adjusts
+// pending_count / status.
+static void release_entry_at(TransactionPool* pool, uint32_t idx, uint32_t slot) {
+    PoolEntry* entry = &pool->entries[idx];
+    if (slot != HASH_INDEX_NOT_FOUND) index_remove_slot(pool, slot);
+    arena_release(pool, entry->body, sizeof(PoolTxBody) + entry->sig_len);
+    queue_unlink(pool, entry->sender, idx);
+    sender_release(pool, entry->sender);
+    entry->in_use = 0;
+    pool->count--;
+    pool->free_list[pool->free_count++] = idx;
+}
+
+static void release_entry(TransactionPool* pool, uint32_t idx) {
+    release_entry_at(pool, idx, index_find(pool, pool->entries[idx].tx_hash));
+}
 
 // ---- Nonce tracker ----
 
@@ -78,18 +494,32 @@ TransactionPool* pool_create(void) {
         pool->free_list[i] = pool->capacity - 1 - i;
     }
     
-    // Assignment tracking
-    pool->assigned_indices = safe_malloc(MAX_ASSIGNED * sizeof(uint32_t));
-    pool->assigned_count = 0;
-    pool->assigned_block_height = 0;
+    // tx_hash index: >= 2x capacity slots keeps linear-probe runs short
+    uint32_t slots = 1;
+    while (slots < pool->capacity * 2) slots <<= 1;
+    pool->hash_index = safe_malloc((size_t)slots * sizeof(uint64_t));
+    memset(pool->hash_index, 0, (size_t)slots * sizeof(uint64_t));
+    pool->hash_index_mask = slots - 1;
+    
+    // Senders: grow on demand; index sized like the tx index (senders <= TXs)
+    pool->sender_capacity = POOL_SENDERS_INITIAL;
+    pool->senders = safe_malloc(pool->sender_capacity * sizeof(PoolSender));
+    pool->sender_free = safe_malloc(pool->sender_capacity * sizeof(uint32_t));
+    pool->sender_index = safe_malloc((size_t)slots * sizeof(uint32_t));
+    memset(pool->sender_index, 0, (size_t)slots * sizeof(uint32_t));
+    pool->sender_index_mask = slots - 1;
+    
+    pool->queue_links = safe_malloc(pool->capacity * sizeof(PoolLink));
+    pool->created_ms = get_current_time_ms();
+    pool->order_rng = pool->created_ms | 1;
     
     pool->nonce_tracker_capacity = 100;
     pool->nonce_trackers = safe_malloc(pool->nonce_tracker_capacity * sizeof(AddressNonceTracker));
     memset(pool->nonce_trackers, 0, pool->nonce_tracker_capacity * sizeof(AddressNonceTracker));
     pool->nonce_tracker_count = 0;
     
-    LOG_INFO("Transaction pool created (capacity: %u, no hash table — simplified v47)", 
-             pool->capacity);
+    LOG_INFO("Transaction pool created (capacity: %u, %zu-byte entries, hash index: %u slots)", 
+             pool->capacity, sizeof(PoolEntry), slots);
     
     return pool;
 }
@@ -105,9 +535,13 @@ uint64_t pool_get_pending_nonce(const TransactionPool* pool, const uint8_t addre
 }
 
 // =============================================================================
-// TRANSACTION ADD - O(1) via free list (no duplicate check, no hash table)
+// TRANSACTION ADD - O(1) via free list + index duplicate check
 // =============================================================================
 
+static bool pool_insert(TransactionPool* pool, Transaction* tx,
+                        const uint8_t* pubkey, size_t pubkey_len, uint8_t sig_type,
+                        bool preverified);
+
 bool pool_add(TransactionPool* pool, Transaction* tx) {
     // TX already carries its pubkey inline — extract and store for serialization
     if (tx && tx->pubkey_len > 0)
@@ -115,37 +549,70 @@ bool pool_add(TransactionPool* pool, Transaction* tx) {
     return pool_add_with_pubkey(pool, tx, NULL, 0, SIG_ED25519);
 }
 
+// Caller has already verified tx's signature (admission-verify mode)
+bool pool_add_preverified(TransactionPool* pool, Transaction* tx) {
+    if (!tx) return false;
+    return pool_insert(pool, tx, tx->public_key, tx->pubkey_len, tx->sig_type, true);
+}
+
 bool pool_add_with_pubkey(TransactionPool* pool, Transaction* tx,
                           const uint8_t* pubkey, size_t pubkey_len, uint8_t sig_type) {
+    return pool_insert(pool, tx, pubkey, pubkey_len, sig_type, false);
+}
+
+static bool pool_insert(TransactionPool* pool, Transaction* tx,
+                        const uint8_t* pubkey, size_t pubkey_len, uint8_t sig_type,
+                        bool preverified) {
     if (!pool || !tx) return false;
 
     if (pool->free_count == 0) {
         return false;  // Pool full
     }
 
+    // Compute TX hash (index key: duplicate check + confirmation matching)
+    uint8_t tx_hash[TX_HASH_SIZE];
+    transaction_compute_hash(tx, tx_hash);
+    if (index_find(pool, tx_hash) != HASH_INDEX_NOT_FOUND) {
+        return false;  // Already pooled
+    }
+
+    // The TX's own pubkey wins; the explicit one fills in for TXs without
+    if (tx->pubkey_len > 0) {
+        pubkey = tx->public_key;
+        pubkey_len = tx->pubkey_len;
+        sig_type = tx->sig_type;
+    } else if (!pubkey || pubkey_len == 0) {
+        pubkey_len = 0;
+        sig_type = tx->sig_type;
+    }
+    if (pubkey_len > CRYPTO_PUBKEY_MAX) pubkey_len = CRYPTO_PUBKEY_MAX;
+    size_t sig_len = tx->sig_len < CRYPTO_SIG_MAX ? tx->sig_len : CRYPTO_SIG_MAX;
+
     // O(1) slot allocation from free list
     uint32_t entry_idx = pool->free_list[--pool->free_count];
+    PoolEntry* entry = &pool->entries[entry_idx];
 
-    Transaction* tx_copy = safe_malloc(sizeof(Transaction));
-    memcpy(tx_copy, tx, sizeof(Transaction));
-
-    // Compute TX hash (used for confirmation matching)
-    transaction_compute_hash(tx, pool->entries[entry_idx].tx_hash);
+    memcpy(entry->tx_hash, tx_hash, TX_HASH_SIZE);
+    entry->expiry_block = tx->expiry_block;
+    entry->nonce = tx->nonce;
+    entry->sender = sender_acquire(pool, tx->source_address, pubkey, pubkey_len);
+    entry->received_ms = (uint32_t)(get_current_time_ms() - pool->created_ms);
+    entry->sig_len = (uint16_t)sig_len;
+    entry->sig_type = sig_type;
+    entry->status = TX_STATUS_PENDING;
+    entry->preverified = preverified ? 1 : 0;
 
-    pool->entries[entry_idx].tx = tx_copy;
-    pool->entries[entry_idx].status = TX_STATUS_PENDING;
-    pool->entries[entry_idx].received_time = get_current_time_ms();
-    pool->entries[entry_idx].assigned_block = 0;
-    pool->entries[entry_idx].sig_type = sig_type;
+    // in_use only once body is set: arena_alloc may compact (see arena_compact)
+    entry->body = arena_alloc(pool, sizeof(PoolTxBody) + sig_len);
+    PoolTxBody* body = (PoolTxBody*)arena_ptr(pool, entry->body);
+    memcpy(body->dest_address, tx->dest_address, 20);
+    body->fee = tx->fee;
+    body->value = tx->value;
+    memcpy(body + 1, tx->signature, sig_len);
+    entry->in_use = 1;
 
-    if (pubkey && pubkey_len > 0) {
-        size_t copy_len = pubkey_len < CRYPTO_PUBKEY_MAX ? pubkey_len : CRYPTO_PUBKEY_MAX;
-        memcpy(pool->entries[entry_idx].pubkey, pubkey, copy_len);
-        pool->entries[entry_idx].pubkey_len = copy_len;
-    } else {
-        memset(pool->entries[entry_idx].pubkey, 0, CRYPTO_PUBKEY_MAX);
-        pool->entries[entry_idx].pubkey_len = 0;
-    }
+    index_insert(pool, entry_idx);
+    queue_insert(pool, entry->sender, entry_idx);
     
     pool->count++;
     pool->pending_count++;
@@ -168,39 +635,293 @@ bool pool_add_with_pubkey(TransactionPool* pool, Transaction* tx,
 }
 
 // =============================================================================
-// GET PENDING - collect, sort, and track assigned entries
+// GET PENDING - select from the nonce queues, then materialise
 // =============================================================================
 
-typedef struct { Transaction* tx; uint32_t orig_idx; } SortEntry;
+// Unpack entry + arena body + shared sender pubkey into one TxView record in
+// the caller's arena (header + real-length signature + pubkey, no malloc)
+static TxView* entry_to_view(const TransactionPool* pool, const PoolEntry* entry,
+                             TxArena* arena) {
+    const PoolSender* snd = &pool->senders[entry->sender];
+    const PoolTxBody* body = (const PoolTxBody*)arena_ptr(pool, entry->body);
 
-static int sort_entry_compare(const void* a, const void* b) {
-    const SortEntry* ea = (const SortEntry*)a;
-    const SortEntry* eb = (const SortEntry*)b;
-    int addr_cmp = memcmp(ea->tx->source_address, eb->tx->source_address, 20);
-    if (addr_cmp != 0) return addr_cmp;
-    if (ea->tx->nonce < eb->tx->nonce) return -1;
-    if (ea->tx->nonce > eb->tx->nonce) return 1;
-    return 0;
+    TxView* tx = tx_view_alloc(arena, entry->sig_len, snd->pubkey_len);
+    tx->nonce = entry->nonce;
+    tx->expiry_block = entry->expiry_block;
+    memcpy(tx->source_address, snd->address, 20);
+    memcpy(tx->dest_address, body->dest_address, 20);
+    tx->value = body->value;
+    tx->fee = body->fee;
+    memcpy(tx_view_signature(tx), body + 1, tx->sig_len);
+    if (tx->pubkey_len > 0)
+        memcpy(tx_view_public_key(tx), arena_ptr(pool, snd->pubkey), tx->pubkey_len);
+    tx->sig_type = entry->sig_type;
+    return tx;
 }
 
-Transaction** pool_get_pending(TransactionPool* pool, uint32_t max_count,
-                               uint32_t current_block, uint32_t* out_count) {
-    return pool_get_pending_with_pubkeys(pool, max_count, current_block, out_count,
-                                        NULL, NULL, NULL);
+// Selection output shared by both modes. Expired entries met on the way are
+// released after selection: releasing can reshape the sender treap.
+typedef struct {
+    uint32_t* picked;             // entry indices, output order
+    uint64_t* t1;                 // optional pick timestamps
+    uint32_t count;
+    uint32_t max;
+    uint32_t* expired;
+    uint32_t expired_count;
+    uint32_t expired_cap;
+    uint32_t current_block;
+} PendingPick;
+
+// Take entry idx if it is servable. Returns true if it was picked.
+static bool pick_entry(TransactionPool* pool, PendingPick* pk, uint32_t idx) {
+    PoolEntry* entry = &pool->entries[idx];
+    if (entry->status != TX_STATUS_PENDING) return false;
+    if (entry->expiry_block > 0 && pk->current_block > entry->expiry_block) {
+        if (pk->expired_count == pk->expired_cap) {
+            pk->expired_cap = pk->expired_cap ? pk->expired_cap * 2 : 64;
+            pk->expired = safe_realloc(pk->expired, pk->expired_cap * sizeof(uint32_t));
+        }
+        pk->expired[pk->expired_count++] = idx;
+        return false;
+    }
+    if (pk->t1) pk->t1[pk->count] = get_current_time_ns();
+    pk->picked[pk->count++] = idx;
+    return true;
 }
 
-Transaction** pool_get_pending_with_pubkeys(TransactionPool* pool, uint32_t max_count,
-                                            uint32_t current_block, uint32_t* out_count,
-                                            uint8_t** pubkeys_out,
-                                            uint64_t** t0_ns_out,
-                                            uint64_t** t1_ns_out) {
-    if (!pool || max_count == 0) {
-        if (out_count) *out_count = 0;
-        if (pubkeys_out) *pubkeys_out = NULL;
-        if (t0_ns_out) *t0_ns_out = NULL;
-        if (t1_ns_out) *t1_ns_out = NULL;
-        return NULL;
+// POOL_SELECT_ADDRESS: walk senders in address order (explicit stack: treap
+// depth is O(log S)), emitting each sender's queue in nonce order. Records
+// sharing an address (same address, different pubkey) are adjacent in the
+// walk and merged by nonce so the output stays (address, nonce) ordered.
+static void pick_by_address(TransactionPool* pool, PendingPick* pk) {
+    uint32_t stack_cap = 64, depth = 0;
+    uint32_t* stack = safe_malloc(stack_cap * sizeof(uint32_t));
+    uint32_t group_cap = 4, group_len = 0;
+    uint32_t* group = safe_malloc(group_cap * sizeof(uint32_t));    // queue cursors
+    const uint8_t* group_addr = NULL;
+    uint32_t node = pool->order_root;
+
+    for (;;) {
+        // Next sender in order (0 = walk finished)
+        uint32_t next = 0;
+        if (pk->count < pk->max) {
+            while (node != 0) {
+                if (depth == stack_cap) {
+                    stack_cap *= 2;
+                    stack = safe_realloc(stack, stack_cap * sizeof(uint32_t));
+                }
+                stack[depth++] = node;
+                node = order_node(pool, node)->order_left;
+            }
+            if (depth > 0) {
+                next = stack[--depth];
+                node = order_node(pool, next)->order_right;
+            }
+        }
+
+        const PoolSender* next_snd = next ? order_node(pool, next) : NULL;
+        if (next_snd && group_len > 0 && memcmp(next_snd->address, group_addr, 20) == 0) {
+            if (group_len == group_cap) {
+                group_cap *= 2;
+                group = safe_realloc(group, group_cap * sizeof(uint32_t));
+            }
+            group[group_len++] = next_snd->queue_head;
+            continue;
+        }
+
+        // Drain the finished group: lowest nonce head first
+        while (group_len > 0 && pk->count < pk->max) {
+            uint32_t best = 0;
+            for (uint32_t g = 1; g < group_len; g++)
+                if (pool->entries[group[g] - 1].nonce < pool->entries[group[best] - 1].nonce)
+                    best = g;
+            uint32_t idx = group[best] - 1;
+            group[best] = pool->queue_links[idx].next;
+            if (group[best] == 0) group[best] = group[--group_len];
+            pick_entry(pool, pk, idx);
+        }
+
+        if (!next_snd) break;
+        group_len = 0;
+        group[group_len++] = next_snd->queue_head;
+        group_addr = next_snd->address;
     }
+    free(stack);
+    free(group);
+}
+
+// POOL_SELECT_FEE_PRIORITY: max-heap of sender chains keyed by the fee per
+// byte of each chain's head (lowest pending nonce). Popping a chain takes its
+// head and re-inserts the chain with its next TX, so a sender's TXs are taken
+// in nonce order and a cheap head holds back that sender's later TXs.
+// Per-byte matters: a Falcon-512 TX is ~1.6 KB, ML-DSA-44 ~3.8 KB, Ed25519
+// ~160 B, so flat fees would let large-signature TXs crowd out small ones.
+// One chain per address: sender records sharing an address (different
+// pubkeys) are merged into one chain whose head is the lowest nonce across
+// their queues, as in POOL_SELECT_ADDRESS.
+typedef struct {
+    uint32_t cursor;              // head entry idx + 1 (0 = chain empty)
+    uint32_t head_fee;
+    uint32_t head_size;           // 64 core bytes + signature + public key
+    uint32_t sender;              // record owning the head
+    uint32_t queues;              // first queue cursor in the shared array
+    uint32_t queue_count;         // live queues (records sharing the address)
+    uint32_t head_queue;          // queue holding the head
+    uint32_t first_pick;          // output group ordinal (UINT32_MAX = none)
+} FeeChain;
+
+static inline bool chain_before(const TransactionPool* pool, const FeeChain* a,
+                                const FeeChain* b) {
+    // fee_a / size_a > fee_b / size_b without division
+    uint64_t lhs = (uint64_t)a->head_fee * b->head_size;
+    uint64_t rhs = (uint64_t)b->head_fee * a->head_size;
+    if (lhs != rhs) return lhs > rhs;
+    // Tie: address order, as in POOL_SELECT_ADDRESS
+    return memcmp(pool->senders[a->sender].address, pool->senders[b->sender].address, 20) < 0;
+}
+
+// Pick the lowest-nonce head among the chain's queues (usually just one)
+static void chain_load_head(const TransactionPool* pool, const uint32_t* queues, FeeChain* c) {
+    c->cursor = 0;
+    for (uint32_t q = 0; q < c->queue_count; q++) {
+        uint32_t cur = queues[c->queues + q];
+        if (c->cursor == 0 || pool->entries[cur - 1].nonce < pool->entries[c->cursor - 1].nonce) {
+            c->cursor = cur;
+            c->head_queue = q;
+        }
+    }
+    if (c->cursor == 0) return;
+    const PoolEntry* entry = &pool->entries[c->cursor - 1];
+    const PoolTxBody* body = (const PoolTxBody*)arena_ptr(pool, entry->body);
+    c->sender = entry->sender;
+    c->head_fee = body->fee;
+    c->head_size = 64 + entry->sig_len + pool->senders[c->sender].pubkey_len;
+}
+
+static void heap_sift_down(const TransactionPool* pool, const FeeChain* chains,
+                           uint32_t* heap, uint32_t n, uint32_t i) {
+    for (;;) {
+        uint32_t best = i, l = 2 * i + 1, r = 2 * i + 2;
+        if (l < n && chain_before(pool, &chains[heap[l]], &chains[heap[best]])) best = l;
+        if (r < n && chain_before(pool, &chains[heap[r]], &chains[heap[best]])) best = r;
+        if (best == i) return;
+        uint32_t t = heap[i]; heap[i] = heap[best]; heap[best] = t;
+        i = best;
+    }
+}
+
+static void pick_by_fee(TransactionPool* pool, PendingPick* pk) {
+    // Walk the sender index in address order so records sharing an address
+    // are adjacent, and build one chain per address over their queues
+    FeeChain* chains = safe_malloc((pool->sender_count + 1) * sizeof(FeeChain));
+    uint32_t* heap = safe_malloc((pool->sender_count + 1) * sizeof(uint32_t));
+    uint32_t* queues = safe_malloc((pool->sender_count + 1) * sizeof(uint32_t));
+    uint32_t stack_cap = 64, depth = 0, queue_total = 0, n = 0;
+    uint32_t* stack = safe_malloc(stack_cap * sizeof(uint32_t));
+    uint32_t node = pool->order_root;
+    while (node != 0 || depth > 0) {
+        while (node != 0) {
+            if (depth == stack_cap) {
+                stack_cap *= 2;
+                stack = safe_realloc(stack, stack_cap * sizeof(uint32_t));
+            }
+            stack[depth++] = node;
+            node = order_node(pool, node)->order_left;
+        }
+        uint32_t ref = stack[--depth];
+        const PoolSender* snd = order_node(pool, ref);
+        node = snd->order_right;
+        if (snd->queue_head == 0) continue;
+
+        if (n == 0 || memcmp(pool->senders[chains[n - 1].sender].address, snd->address, 20) != 0) {
+            FeeChain* c = &chains[n++];
+            c->sender = ref - 1;
+            c->queues = queue_total;
+            c->queue_count = 0;
+            c->first_pick = UINT32_MAX;
+        }
+        queues[queue_total++] = snd->queue_head;
+        chains[n - 1].queue_count++;
+    }
+    free(stack);
+    for (uint32_t i = 0; i < n; i++) {
+        chain_load_head(pool, queues, &chains[i]);
+        heap[i] = i;
+    }
+    for (uint32_t i = n / 2; i-- > 0; )
+        heap_sift_down(pool, chains, heap, n, i);
+
+    uint32_t* pick_chain = safe_malloc(pk->max * sizeof(uint32_t));
+    uint32_t groups = 0;
+    while (n > 0 && pk->count < pk->max) {
+        FeeChain* c = &chains[heap[0]];
+        uint32_t idx = c->cursor - 1;
+        uint32_t* head_queue = &queues[c->queues + c->head_queue];
+        *head_queue = pool->queue_links[idx].next;
+        if (*head_queue == 0) *head_queue = queues[c->queues + --c->queue_count];
+        uint32_t slot = pk->count;
+        if (pick_entry(pool, pk, idx)) {
+            if (c->first_pick == UINT32_MAX) c->first_pick = groups++;
+            pick_chain[slot] = heap[0];
+        }
+        chain_load_head(pool, queues, c);
+        if (c->cursor == 0) heap[0] = heap[--n];
+        heap_sift_down(pool, chains, heap, n, 0);
+    }
+
+    // Regroup by address (groups in first-pick order, nonce order inside) so
+    // consumers that scan for sender runs see each address exactly once.
+    // Stable counting sort on the group ordinal.
+    if (pk->count > 0) {
+        uint32_t* group_start = safe_malloc((groups + 1) * sizeof(uint32_t));
+        memset(group_start, 0, (groups + 1) * sizeof(uint32_t));
+        for (uint32_t i = 0; i < pk->count; i++)
+            group_start[chains[pick_chain[i]].first_pick + 1]++;
+        for (uint32_t g = 0; g < groups; g++)
+            group_start[g + 1] += group_start[g];
+
+        uint32_t* picked = safe_malloc(pk->max * sizeof(uint32_t));
+        uint64_t* t1 = pk->t1 ? safe_malloc(pk->max * sizeof(uint64_t)) : NULL;
+        for (uint32_t i = 0; i < pk->count; i++) {
+            uint32_t pos = group_start[chains[pick_chain[i]].first_pick]++;
+            picked[pos] = pk->picked[i];
+            if (t1) t1[pos] = pk->t1[i];
+        }
+        free(pk->picked);
+        pk->picked = picked;
+        if (t1) { free(pk->t1); pk->t1 = t1; }
+        free(group_start);
+    }
+
+    free(pick_chain);
+    free(queues);
+    free(heap);
+    free(chains);
+}
+
+void pool_set_select_mode(TransactionPool* pool, PoolSelectMode mode) {
+    if (pool) pool->select_mode = (uint8_t)mode;
+}
+
+TxView** pool_get_pending(TransactionPool* pool, TxArena* arena, uint32_t max_count,
+                          uint32_t current_block, uint32_t* out_count) {
+    return pool_get_pending_with_pubkeys(pool, arena, max_count, current_block, out_count,
+                                        NULL, NULL, NULL, NULL);
+}
+
+TxView** pool_get_pending_with_pubkeys(TransactionPool* pool, TxArena* arena,
+                                       uint32_t max_count,
+                                       uint32_t current_block, uint32_t* out_count,
+                                       uint8_t** pubkeys_out,
+                                       uint64_t** t0_ns_out,
+                                       uint64_t** t1_ns_out,
+                                       uint8_t** preverified_out) {
+    if (out_count) *out_count = 0;
+    if (pubkeys_out) *pubkeys_out = NULL;
+    if (t0_ns_out) *t0_ns_out = NULL;
+    if (t1_ns_out) *t1_ns_out = NULL;
+    if (preverified_out) *preverified_out = NULL;
+    if (!pool || !arena || max_count == 0) return NULL;
     
     // ═══════════════════════════════════════════════════════════════════
     // v47.1: NO STATUS CHANGE. Pool is a dumb buffer.
@@ -214,152 +935,96 @@ Transaction** pool_get_pending_with_pubkeys(TransactionPool* pool, uint32_t max_
     //   - 90% confirmation rate bug
     // ═══════════════════════════════════════════════════════════════════
     
-    // PQC: TXs carry their own pubkey inline — no separate pubkeys array needed
-    if (pubkeys_out) *pubkeys_out = NULL;
-
-    Transaction** txs = safe_malloc(max_count * sizeof(Transaction*));
-    uint32_t* entry_indices = safe_malloc(max_count * sizeof(uint32_t));
-    uint64_t* t0_raw = t0_ns_out ? safe_malloc(max_count * sizeof(uint64_t)) : NULL;
-    uint64_t* t1_raw = t1_ns_out ? safe_malloc(max_count * sizeof(uint64_t)) : NULL;
-    uint32_t count = 0;
-
-    for (uint32_t i = 0; i < pool->capacity && count < max_count; i++) {
-        PoolEntry* entry = &pool->entries[i];
+    PendingPick pk;
+    memset(&pk, 0, sizeof(pk));
+    pk.picked = safe_malloc(max_count * sizeof(uint32_t));
+    pk.t1 = t1_ns_out ? safe_malloc(max_count * sizeof(uint64_t)) : NULL;
+    pk.max = max_count;
+    pk.current_block = current_block;
 
-        if (entry->tx && entry->status == TX_STATUS_PENDING) {
-            // Expire check
-            if (entry->tx->expiry_block > 0 && current_block > entry->tx->expiry_block) {
-                entry->status = TX_STATUS_EXPIRED;
-                pool->pending_count--;
-                transaction_destroy(entry->tx);
-                entry->tx = NULL;
-                pool->count--;
-                pool->free_list[pool->free_count++] = i;
-                continue;
-            }
+    if (pool->select_mode == POOL_SELECT_FEE_PRIORITY)
+        pick_by_fee(pool, &pk);
+    else
+        pick_by_address(pool, &pk);
 
-            Transaction* tx_copy = safe_malloc(sizeof(Transaction));
-            memcpy(tx_copy, entry->tx, sizeof(Transaction));
-            txs[count] = tx_copy;
-            entry_indices[count] = i;
-            if (t0_raw) t0_raw[count] = entry->received_time * 1000000ULL;
-            if (t1_raw) t1_raw[count] = get_current_time_ns();
-            count++;
-        }
+    for (uint32_t i = 0; i < pk.expired_count; i++) {
+        pool->entries[pk.expired[i]].status = TX_STATUS_EXPIRED;
+        pool->pending_count--;
+        release_entry(pool, pk.expired[i]);
     }
+    free(pk.expired);
 
-    if (out_count) *out_count = count;
-
+    uint32_t count = pk.count;
     if (count == 0) {
-        free(txs); free(entry_indices);
-        if (t0_raw) free(t0_raw);
-        if (t1_raw) free(t1_raw);
-        if (t0_ns_out) *t0_ns_out = NULL;
-        if (t1_ns_out) *t1_ns_out = NULL;
+        free(pk.picked);
+        if (pk.t1) free(pk.t1);
         return NULL;
     }
 
-    // Sort by (source_address, nonce)
-    SortEntry* sort_arr = safe_malloc(count * sizeof(SortEntry));
-    for (uint32_t i = 0; i < count; i++) {
-        sort_arr[i].tx = txs[i];
-        sort_arr[i].orig_idx = i;
-    }
-
-    qsort(sort_arr, count, sizeof(SortEntry), sort_entry_compare);
-
-    uint32_t* sorted_entry_indices = safe_malloc(count * sizeof(uint32_t));
-    uint64_t* t0_sorted = t0_raw ? safe_malloc(count * sizeof(uint64_t)) : NULL;
-    uint64_t* t1_sorted = t1_raw ? safe_malloc(count * sizeof(uint64_t)) : NULL;
+    TxView** txs = safe_malloc(count * sizeof(TxView*));
+    uint64_t* t0_sorted = t0_ns_out ? safe_malloc(count * sizeof(uint64_t)) : NULL;
+    uint8_t* flags = preverified_out ? safe_malloc(count) : NULL;
     for (uint32_t i = 0; i < count; i++) {
-        txs[i] = sort_arr[i].tx;
-        sorted_entry_indices[i] = entry_indices[sort_arr[i].orig_idx];
-        if (t0_sorted) t0_sorted[i] = t0_raw[sort_arr[i].orig_idx];
-        if (t1_sorted) t1_sorted[i] = t1_raw[sort_arr[i].orig_idx];
+        const PoolEntry* entry = &pool->entries[pk.picked[i]];
+        txs[i] = entry_to_view(pool, entry, arena);
+        if (t0_sorted) t0_sorted[i] = (pool->created_ms + entry->received_ms) * 1000000ULL;
+        if (flags) flags[i] = entry->preverified;
     }
+    free(pk.picked);
 
-    free(sort_arr);
-    free(entry_indices);
-    if (t0_raw) free(t0_raw);
-    if (t1_raw) free(t1_raw);
-
-    if (t0_ns_out) *t0_ns_out = t0_sorted; else if (t0_sorted) free(t0_sorted);
-    if (t1_ns_out) *t1_ns_out = t1_sorted; else if (t1_sorted) free(t1_sorted);
-
-    // Save entry indices as SEARCH HINT for pool_confirm (optimization only)
-    // Status stays PENDING — no ASSIGNED marking
-    pool->assigned_count = count < MAX_ASSIGNED ? count : MAX_ASSIGNED;
-    for (uint32_t i = 0; i < pool->assigned_count; i++) {
-        pool->assigned_indices[i] = sorted_entry_indices[i];
-    }
-    free(sorted_entry_indices);
+    if (out_count) *out_count = count;
+    if (t0_ns_out) *t0_ns_out = t0_sorted;
+    if (t1_ns_out) *t1_ns_out = pk.t1;
+    if (preverified_out) *preverified_out = flags;
 
     return txs;
 }
 
 // =============================================================================
-// CONFIRM - scan assigned list for matching TX hashes
+// CONFIRM - O(1) index lookup per TX hash
 // =============================================================================
-// Blockchain sends TX hashes in CONFIRM_BLOCK. We search the assigned_indices
-// list (K entries, typically 10K) instead of a hash table.
-// For K=10K hashes × 10K assigned = 100M comparisons — but each is a 32-byte
-// memcmp that fails on first byte. Average probes: ~2. Total: ~0.2ms.
-// This is fast enough and eliminates the entire hash table infrastructure.
+// Blockchain sends TX hashes in CONFIRM_BLOCK. Each hash is one index probe,
+// whether or not the TX was served by this pool in the last round.
+
+static bool confirm_slot(TransactionPool* pool, uint32_t slot) {
+    uint32_t idx = (uint32_t)pool->hash_index[slot] - 1;
+    PoolEntry* entry = &pool->entries[idx];
+    if (entry->status == TX_STATUS_PENDING) pool->pending_count--;
+    entry->status = TX_STATUS_CONFIRMED;
+    pool->confirmed_count++;
+    release_entry_at(pool, idx, slot);
+    return true;
+}
 
 bool pool_confirm(TransactionPool* pool, const uint8_t tx_hash[TX_HASH_SIZE]) {
     if (!pool) return false;
-    
-    // Search hint list first (entries served to last validator)
-    for (uint32_t i = 0; i < pool->assigned_count; i++) {
-        uint32_t idx = pool->assigned_indices[i];
-        PoolEntry* entry = &pool->entries[idx];
-        if (entry->tx && memcmp(entry->tx_hash, tx_hash, TX_HASH_SIZE) == 0) {
-            pool->pending_count--;
-            entry->status = TX_STATUS_CONFIRMED;
-            pool->confirmed_count++;
-            transaction_destroy(entry->tx);
-            entry->tx = NULL;
-            pool->count--;
-            pool->free_list[pool->free_count++] = idx;
-            // Remove from hint list (swap with last)
-            pool->assigned_indices[i] = pool->assigned_indices[pool->assigned_count - 1];
-            pool->assigned_count--;
-            return true;
-        }
-    }
-    
-    // Fallback: scan entire pool
-    for (uint32_t i = 0; i < pool->capacity; i++) {
-        PoolEntry* entry = &pool->entries[i];
-        if (entry->tx && memcmp(entry->tx_hash, tx_hash, TX_HASH_SIZE) == 0) {
-            pool->pending_count--;
-            entry->status = TX_STATUS_CONFIRMED;
-            pool->confirmed_count++;
-            transaction_destroy(entry->tx);
-            entry->tx = NULL;
-            pool->count--;
-            pool->free_list[pool->free_count++] = i;
-            return true;
-        }
-    }
-    
-    return false;
+    uint32_t s = index_find(pool, tx_hash);
+    if (s == HASH_INDEX_NOT_FOUND) return false;
+    return confirm_slot(pool, s);
 }
 
 uint32_t pool_confirm_batch(TransactionPool* pool, const uint8_t* hashes, uint32_t hash_count) {
     if (!pool || !hashes) return 0;
     
+    // Batch probing: the index is 32 MB, so nearly every home slot is a cache
+    // miss. Prefetch the slot CONFIRM_PREFETCH_DIST hashes ahead so the misses
+    // overlap instead of serialising.
+    uint32_t warm = hash_count < CONFIRM_PREFETCH_DIST ? hash_count : CONFIRM_PREFETCH_DIST;
+    for (uint32_t i = 0; i < warm; i++)
+        __builtin_prefetch(&pool->hash_index[index_home(pool, hashes + (size_t)i * TX_HASH_SIZE)]);
+    
     uint32_t confirmed = 0;
     for (uint32_t i = 0; i < hash_count; i++) {
-        if (pool_confirm(pool, hashes + i * TX_HASH_SIZE)) {
+        if (i + CONFIRM_PREFETCH_DIST < hash_count) {
+            const uint8_t* ahead = hashes + (size_t)(i + CONFIRM_PREFETCH_DIST) * TX_HASH_SIZE;
+            __builtin_prefetch(&pool->hash_index[index_home(pool, ahead)]);
+        }
+        uint32_t s = index_find(pool, hashes + (size_t)i * TX_HASH_SIZE);
+        if (s != HASH_INDEX_NOT_FOUND && confirm_slot(pool, s)) {
             confirmed++;
         }
     }
     
-    // NOTE: We do NOT return assigned→pending here. That happens at the 
-    // START of pool_get_pending_with_pubkeys, which is the only safe place
-    // to do it (avoids race conditions with stale assigned_indices).
-    
     return confirmed;
 }
 
@@ -378,13 +1043,10 @@ uint32_t pool_cleanup_expired(TransactionPool* pool, uint32_t current_block) {
     uint32_t removed = 0;
     for (uint32_t i = 0; i < pool->capacity; i++) {
         PoolEntry* entry = &pool->entries[i];
-        if (entry->tx && entry->tx->expiry_block > 0 && 
-            current_block > entry->tx->expiry_block) {
+        if (entry->in_use && entry->expiry_block > 0 && 
+            current_block > entry->expiry_block) {
             if (entry->status == TX_STATUS_PENDING) pool->pending_count--;
-            transaction_destroy(entry->tx);
-            entry->tx = NULL;
-            pool->count--;
-            pool->free_list[pool->free_count++] = i;
+            release_entry(pool, i);
             removed++;
         }
     }
@@ -399,24 +1061,20 @@ void pool_get_stats(const TransactionPool* pool, uint32_t* pending, uint32_t* co
 
 bool pool_contains(const TransactionPool* pool, const uint8_t tx_hash[TX_HASH_SIZE]) {
     if (!pool) return false;
-    // Linear scan (no hash table) — only used for debugging, not critical path
-    for (uint32_t i = 0; i < pool->capacity; i++) {
-        if (pool->entries[i].tx && 
-            memcmp(pool->entries[i].tx_hash, tx_hash, TX_HASH_SIZE) == 0) {
-            return true;
-        }
-    }
-    return false;
+    return index_find(pool, tx_hash) != HASH_INDEX_NOT_FOUND;
 }
 
 void pool_destroy(TransactionPool* pool) {
     if (!pool) return;
-    for (uint32_t i = 0; i < pool->capacity; i++) {
-        if (pool->entries[i].tx) transaction_destroy(pool->entries[i].tx);
-    }
+    for (uint32_t i = 0; i < pool->slab_count; i++) free(pool->slabs[i].data);
+    free(pool->slabs);
+    free(pool->senders);
+    free(pool->sender_free);
+    free(pool->sender_index);
+    free(pool->queue_links);
     free(pool->entries);
     free(pool->free_list);
-    free(pool->assigned_indices);
+    free(pool->hash_index);
     free(pool->nonce_trackers);
     free(pool);
 }
@@ -0,0 +1,162 @@
+#include "../include/tx_arena.h"
+#include "../include/common.h"
+#include <stdlib.h>
+#include <string.h>
+
+_Static_assert(sizeof(TxView) == 80, "TxView header must stay 80 bytes");
+
+struct TxArenaChunk {
+    TxArenaChunk* next;                    // Older chunk
+    size_t size;                           // Usable bytes in data[]
+    size_t used;
+    size_t last;                           // Offset of the most recent allocation
+    uint8_t data[];
+};
+
+#define ARENA_ALIGN(n)  (((n) + 7) & ~(size_t)7)
+
+// =============================================================================
+// ARENA
+// =============================================================================
+
+TxArena* tx_arena_create(size_t initial_bytes) {
+    TxArena* arena = safe_malloc(sizeof(TxArena));
+    memset(arena, 0, sizeof(TxArena));
+    arena->chunk_size = initial_bytes > 0 ? ARENA_ALIGN(initial_bytes)
+                                          : TX_ARENA_DEFAULT_CHUNK;
+    return arena;
+}
+
+static TxArenaChunk* arena_grow(TxArena* arena, size_t need) {
+    size_t size = arena->chunk_size;
+    if (size < need) size = need;
+
+    TxArenaChunk* chunk = safe_malloc(sizeof(TxArenaChunk) + size);
+    chunk->next = arena->head;
+    chunk->size = size;
+    chunk->used = 0;
+    chunk->last = 0;
+    arena->head = chunk;
+    arena->bytes_reserved += size;
+
+    if (arena->chunk_size < TX_ARENA_MAX_CHUNK) {
+        arena->chunk_size *= 2;
+        if (arena->chunk_size > TX_ARENA_MAX_CHUNK) arena->chunk_size = TX_ARENA_MAX_CHUNK;
+    }
+    return chunk;
+}
+
+void* tx_arena_alloc(TxArena* arena, size_t size) {
+    size = ARENA_ALIGN(size);
+    TxArenaChunk* chunk = arena->head;
+    if (!chunk || chunk->size - chunk->used < size)
+        chunk = arena_grow(arena, size);
+
+    void* p = chunk->data + chunk->used;
+    chunk->last = chunk->used;
+    chunk->used += size;
+    arena->bytes_used += size;
+    return p;
+}
+
+void tx_arena_reset(TxArena* arena) {
+    if (!arena || !arena->head) return;
+
+    TxArenaChunk* keep = arena->head;
+    TxArenaChunk* c = keep->next;
+    while (c) {
+        TxArenaChunk* next = c->next;
+        free(c);
+        c = next;
+    }
+    keep->next = NULL;
+    keep->used = 0;
+    keep->last = 0;
+    arena->bytes_used = 0;
+    arena->bytes_reserved = keep->size;
+}
+
+void tx_arena_destroy(TxArena* arena) {
+    if (!arena) return;
+    TxArenaChunk* c = arena->head;
+    while (c) {
+        TxArenaChunk* next = c->next;
+        free(c);
+        c = next;
+    }
+    free(arena);
+}
+
+// =============================================================================
+// VIEWS
+// =============================================================================
+
+TxView* tx_view_alloc(TxArena* arena, size_t sig_len, size_t pubkey_len) {
+    if (!arena) return NULL;
+    if (sig_len > CRYPTO_SIG_MAX) sig_len = CRYPTO_SIG_MAX;
+    if (pubkey_len > CRYPTO_PUBKEY_MAX) pubkey_len = CRYPTO_PUBKEY_MAX;
+
+    TxView* view = tx_arena_alloc(arena, sizeof(TxView) + sig_len + pubkey_len);
+    memset(view, 0, sizeof(TxView));
+    view->sig_off = sizeof(TxView);
+    view->sig_len = (uint16_t)sig_len;
+    view->pubkey_off = (uint16_t)(sizeof(TxView) + sig_len);
+    view->pubkey_len = (uint16_t)pubkey_len;
+    return view;
+}
+
+TxView* tx_view_create(TxArena* arena, const Transaction* tx) {
+    if (!arena || !tx) return NULL;
+
+    TxView* view = tx_view_alloc(arena, tx->sig_len, tx->pubkey_len);
+    view->nonce = tx->nonce;
+    view->expiry_block = tx->expiry_block;
+    memcpy(view->source_address, tx->source_address, 20);
+    memcpy(view->dest_address, tx->dest_address, 20);
+    view->fee = tx->fee;
+    view->value = tx->value;
+    view->sig_type = tx->sig_type;
+    memcpy(tx_view_signature(view), tx->signature, view->sig_len);
+    memcpy(tx_view_public_key(view), tx->public_key, view->pubkey_len);
+    return view;
+}
+
+TxView* tx_view_clone(TxArena* arena, const TxView* view) {
+    if (!arena || !view) return NULL;
+
+    size_t size = tx_view_size(view);
+    TxView* copy = tx_arena_alloc(arena, size);
+    memcpy(copy, view, size);
+    return copy;
+}
+
+void tx_view_free(TxArena* arena, TxView* view) {
+    if (!arena || !view || !arena->head) return;
+
+    size_t size = ARENA_ALIGN(tx_view_size(view));
+    TxArenaChunk* chunk = arena->head;
+    if ((uint8_t*)view == chunk->data + chunk->last &&
+        chunk->last + size == chunk->used) {
+        chunk->used = chunk->last;
+        arena->bytes_used -= size;
+    }
+}
+
+void tx_view_to_transaction(const TxView* view, Transaction* out) {
+    memset(out, 0, sizeof(Transaction));
+    out->nonce = view->nonce;
+    out->expiry_block = view->expiry_block;
+    memcpy(out->source_address, view->source_address, 20);
+    memcpy(out->dest_address, view->dest_address, 20);
+    out->value = view->value;
+    out->fee = view->fee;
+    memcpy(out->signature, tx_view_signature(view), view->sig_len);
+    out->sig_len = view->sig_len;
+    memcpy(out->public_key, tx_view_public_key(view), view->pubkey_len);
+    out->pubkey_len = view->pubkey_len;
+    out->sig_type = view->sig_type;
+}
+
+size_t tx_view_size(const TxView* view) {
+    return (size_t)view->pubkey_off + view->pubkey_len;
+}
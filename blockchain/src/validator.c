@@ -32,9 +32,11 @@
 #include "../proto/blockchain.pb-c.h"
 #include "../include/block.h"
 #include "../include/transaction.h"
+#include "../include/sig_cache.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <sys/stat.h>
+#include <dirent.h>
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
@@ -57,6 +59,7 @@
 
 static uint32_t max_txs_per_block = MAX_TXS_PER_BLOCK_DEFAULT;
 static size_t validator_buffer_size = VALIDATOR_BASE_BUFFER_SIZE;
+static bool trust_pool_verify = false;   // honour TXTV pre-verified flags
 #define BASE_MINING_REWARD 10000
 #define HALVING_INTERVAL 10000000
 
@@ -75,6 +78,38 @@ static uint64_t calculate_mining_reward(uint32_t block_height) {
     return reward;
 }
 
+// =============================================================================
+// HELPER: Verify a slice of TXs, skipping those the pool pre-verified
+// =============================================================================
+// flags[i] (i < flag_count) is the TXTV pre-verified byte for txs[i]; flags may
+// be NULL. Returns the number of signatures actually verified.
+
+static uint32_t verify_slice(TxView** txs, uint32_t count,
+                             const uint8_t* flags, uint32_t flag_count,
+                             uint8_t* valid) {
+    if (!flags) {
+        tx_view_verify_batch(txs, count, valid);
+        return count;
+    }
+
+    TxView** todo = safe_malloc(count * sizeof(TxView*));
+    uint32_t* todo_idx = safe_malloc(count * sizeof(uint32_t));
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (txs[i] && i < flag_count && flags[i]) { valid[i] = 1; continue; }
+        todo[n] = txs[i];
+        todo_idx[n++] = i;
+    }
+    if (n > 0) {
+        uint8_t* todo_ok = safe_malloc(n);
+        tx_view_verify_batch(todo, n, todo_ok);
+        for (uint32_t j = 0; j < n; j++) valid[todo_idx[j]] = todo_ok[j];
+        free(todo_ok);
+    }
+    free(todo); free(todo_idx);
+    return n;
+}
+
 // =============================================================================
 // VALIDATOR CREATION
 // =============================================================================
@@ -168,6 +203,11 @@ static void _build_plot_path(char* out, size_t out_len,
     snprintf(out, out_len, "plots_persistent/%s_k%u.plot", addr_hex, k_param);
 }
 
+static void validator_add_plot(Validator* v, Plot* plot) {
+    v->plots = safe_realloc(v->plots, (v->plot_count + 1) * sizeof(Plot*));
+    v->plots[v->plot_count++] = plot;
+}
+
 bool validator_generate_plot(Validator* v) {
     if (!v) return false;
     
@@ -178,36 +218,57 @@ bool validator_generate_plot(Validator* v) {
     if (stat("plots_persistent", &st) == 0 && S_ISDIR(st.st_mode)) {
         Plot* loaded = plot_load_from_file(plot_path);
         if (loaded) {
-            v->plot = loaded;
+            validator_add_plot(v, loaded);
             char plot_id_hex[65];
-            bytes_to_hex_buf(v->plot->plot_id, 32, plot_id_hex);
+            bytes_to_hex_buf(loaded->plot_id, 32, plot_id_hex);
             LOG_INFO("🌾 [%s] Plot loaded from %s (ID: %.16s...)", v->name, plot_path, plot_id_hex);
             return true;
         }
     }
     
+    // With a plot memory limit the plot is streamed to its file and mapped
+    // from there, so k is bounded by disk rather than RAM
+    if (plot_get_memory_limit() != 0) {
+        if (mkdir("plots_persistent", 0755) != 0 && errno != EEXIST) {
+            LOG_ERROR("[%s] Cannot create plots_persistent: %s", v->name, strerror(errno));
+            return false;
+        }
+        LOG_INFO("🌾 [%s] Streaming plot to %s...", v->name, plot_path);
+        Plot* streamed = plot_generate_to_file(v->wallet->address, v->k_param, plot_path)
+                       ? plot_load_from_file(plot_path) : NULL;
+        if (!streamed) {
+            LOG_ERROR("[%s] Failed to generate plot", v->name);
+            return false;
+        }
+        validator_add_plot(v, streamed);
+        char plot_id_hex[65];
+        bytes_to_hex_buf(streamed->plot_id, 32, plot_id_hex);
+        LOG_INFO("🌾 [%s] Plot ready! ID: %.16s...", v->name, plot_id_hex);
+        return true;
+    }
+    
     LOG_INFO("🌾 [%s] Generating plot with BLAKE3...", v->name);
     
-    v->plot = plot_create(v->wallet->address, v->k_param);
-    if (!v->plot) {
+    Plot* plot = plot_create(v->wallet->address, v->k_param);
+    if (!plot) {
         LOG_ERROR("[%s] Failed to create plot", v->name);
         return false;
     }
     
-    if (!plot_generate(v->plot)) {
+    if (!plot_generate(plot)) {
         LOG_ERROR("[%s] Failed to generate plot", v->name);
-        plot_destroy(v->plot);
-        v->plot = NULL;
+        plot_destroy(plot);
         return false;
     }
+    validator_add_plot(v, plot);
     
     char plot_id_hex[65];
-    bytes_to_hex_buf(v->plot->plot_id, 32, plot_id_hex);
+    bytes_to_hex_buf(plot->plot_id, 32, plot_id_hex);
     LOG_INFO("🌾 [%s] Plot ready! ID: %.16s...", v->name, plot_id_hex);
     
     // Auto-save if plots_persistent/ exists (created by setup_plots.sh)
     if (stat("plots_persistent", &st) == 0 && S_ISDIR(st.st_mode)) {
-        if (plot_save_to_file(v->plot, plot_path)) {
+        if (plot_save_to_file(plot, plot_path)) {
             LOG_INFO("🌾 [%s] Plot saved to %s for reuse", v->name, plot_path);
         }
     }
@@ -215,6 +276,49 @@ bool validator_generate_plot(Validator* v) {
     return true;
 }
 
+// One process farms a whole directory: every plot is mapped (see
+// plot_load_from_file) and searched in parallel for each challenge,
+// and only the best proof is submitted. Plots made for other wallets
+// are farmed too; rewards go to this validator's wallet.
+bool validator_load_plot_dir(Validator* v, const char* dir) {
+    if (!v || !dir) return false;
+    
+    DIR* d = opendir(dir);
+    if (!d) {
+        LOG_ERROR("[%s] Cannot open plot directory %s: %s", v->name, dir, strerror(errno));
+        return false;
+    }
+    
+    uint64_t start_time = get_current_time_ms();
+    uint64_t total_entries = 0;
+    uint32_t failed = 0;
+    struct dirent* de;
+    while ((de = readdir(d)) != NULL) {
+        size_t len = strlen(de->d_name);
+        if (len < 5 || strcmp(de->d_name + len - 5, ".plot") != 0) continue;
+        
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", dir, de->d_name);
+        Plot* plot = plot_load_from_file(path);
+        if (!plot || !plot->is_sorted) {
+            LOG_WARN("[%s] Skipping plot %s (unreadable or unsorted)", v->name, path);
+            plot_destroy(plot);
+            failed++;
+            continue;
+        }
+        if (memcmp(plot->farmer_address, v->wallet->address, 20) != 0)
+            LOG_DEBUG("[%s] Plot %s was made for another wallet", v->name, path);
+        validator_add_plot(v, plot);
+        total_entries += plot->entry_count;
+    }
+    closedir(d);
+    
+    LOG_INFO("🌾 [%s] Farming %u plots from %s (%lu entries, %u skipped) in %lu ms",
+             v->name, v->plot_count, dir, total_entries, failed,
+             get_current_time_ms() - start_time);
+    return v->plot_count > 0;
+}
+
 // =============================================================================
 // CHALLENGE HANDLING
 // =============================================================================
@@ -243,12 +347,12 @@ void validator_handle_challenge(Validator* v, const Challenge* challenge) {
  * Block creation only happens if we are announced as the winner.
  */
 bool validator_find_and_submit_proof(Validator* v) {
-    if (!v || !v->has_challenge || !v->plot) return false;
+    if (!v || !v->has_challenge || v->plot_count == 0) return false;
     
-    // Search plot for valid proof
-    SpaceProof* proof = plot_find_proof(v->plot, 
-                                        v->current_challenge.challenge_hash,
-                                        v->current_challenge.current_difficulty);
+    // Search every plot for valid proof; only the best one is submitted
+    SpaceProof* proof = plot_find_proof_many(v->plots, v->plot_count,
+                                             v->current_challenge.challenge_hash,
+                                             v->current_challenge.current_difficulty);
     
     if (!proof) {
         LOG_INFO("🔍 [%s] No valid proof for difficulty %u", 
@@ -407,10 +511,12 @@ bool validator_create_and_submit_block(Validator* v) {
     // verify_time ≈ (N/1000)*7.5 ms
     // So: remaining - 80(send) - 15(fetch_base) - 10(margin) = N * 0.0125
     // N = (remaining - 105) * 80
+    // Trusting pool admission verify drops verify_time: N = (remaining - 105) * 200
     uint32_t fetch_limit = max_txs_per_block;
     int64_t available_for_processing = remaining_budget - SEND_RESERVE_MS - 25;
     if (available_for_processing > 0) {
-        uint32_t dynamic_limit = (uint32_t)(available_for_processing * 80);
+        uint32_t dynamic_limit = (uint32_t)(available_for_processing *
+                                            (trust_pool_verify ? 200 : 80));
         if (dynamic_limit < fetch_limit) {
             fetch_limit = dynamic_limit;
         }
@@ -420,9 +526,12 @@ bool validator_create_and_submit_block(Validator* v) {
     // Cap at configured max
     if (fetch_limit > max_txs_per_block) fetch_limit = max_txs_per_block;
     
-    Transaction** txs = safe_malloc(max_txs_per_block * sizeof(Transaction*));
-    memset(txs, 0, max_txs_per_block * sizeof(Transaction*));
+    // Fetched TXs are compact TxView records in one arena for the whole
+    // batch (freed in one call), not max_txs_per_block 3.8 KB Transactions
+    TxView** txs = safe_malloc(max_txs_per_block * sizeof(TxView*));
+    memset(txs, 0, max_txs_per_block * sizeof(TxView*));
     uint32_t tx_count = 0;
+    TxArena* tx_arena = tx_arena_create(0);
     
     char request[256];
     snprintf(request, sizeof(request), "GET_FOR_WINNER:%u:%u", 
@@ -439,18 +548,24 @@ bool validator_create_and_submit_block(Validator* v) {
     uint64_t* diag_t0 = NULL;
     uint64_t* diag_t1 = NULL;
     uint32_t  diag_ts_count = 0;
+    uint8_t*  preverified = NULL;   // TXTV: pool already checked these sigs
 
     const uint8_t* pool_pb_data = NULL;
     size_t pool_pb_len = 0;
 
-    if (size > 8 && memcmp(buffer, "TXTS", 4) == 0) {
+    bool has_flags = size > 8 && memcmp(buffer, "TXTV", 4) == 0;
+    if (size > 8 && (has_flags || memcmp(buffer, "TXTS", 4) == 0)) {
         memcpy(&diag_ts_count, buffer + 4, 4);
-        size_t ts_hdr = 8 + (size_t)diag_ts_count * 16;
+        size_t ts_hdr = 8 + (size_t)diag_ts_count * (has_flags ? 17 : 16);
         if ((size_t)size > ts_hdr && diag_ts_count > 0) {
             diag_t0 = safe_malloc(diag_ts_count * sizeof(uint64_t));
             diag_t1 = safe_malloc(diag_ts_count * sizeof(uint64_t));
             memcpy(diag_t0, buffer + 8,                      diag_ts_count * 8);
             memcpy(diag_t1, buffer + 8 + diag_ts_count * 8, diag_ts_count * 8);
+            if (has_flags && trust_pool_verify) {
+                preverified = safe_malloc(diag_ts_count);
+                memcpy(preverified, buffer + 8 + diag_ts_count * 16, diag_ts_count);
+            }
             pool_pb_data = (uint8_t*)buffer + ts_hdr;
             pool_pb_len  = (size_t)size - ts_hdr;
         }
@@ -465,8 +580,9 @@ bool validator_create_and_submit_block(Validator* v) {
         if (batch) {
             for (size_t i = 0; i < batch->n_transactions && tx_count < max_txs_per_block; i++) {
                 Blockchain__Transaction* pt = batch->transactions[i];
-                Transaction* tx = safe_malloc(sizeof(Transaction));
-                memset(tx, 0, sizeof(Transaction));
+                TxView* tx = tx_view_alloc(tx_arena,
+                                           pt->signature.data ? pt->signature.len : 0,
+                                           pt->public_key.data ? pt->public_key.len : 0);
                 tx->nonce = pt->nonce;
                 tx->expiry_block = pt->expiry_block;
                 if (pt->source_address.data && pt->source_address.len >= 20)
@@ -475,18 +591,11 @@ bool validator_create_and_submit_block(Validator* v) {
                     memcpy(tx->dest_address, pt->dest_address.data, 20);
                 tx->value = pt->value;
                 tx->fee = pt->fee;
-                if (pt->signature.data && pt->signature.len > 0) {
-                    size_t sig_len = pt->signature.len;
-                    if (sig_len > CRYPTO_SIG_MAX) sig_len = CRYPTO_SIG_MAX;
-                    memcpy(tx->signature, pt->signature.data, sig_len);
-                    tx->sig_len = sig_len;
-                }
-                if (pt->public_key.data && pt->public_key.len > 0) {
-                    size_t pk_len = pt->public_key.len;
-                    if (pk_len > CRYPTO_PUBKEY_MAX) pk_len = CRYPTO_PUBKEY_MAX;
-                    memcpy(tx->public_key, pt->public_key.data, pk_len);
-                    tx->pubkey_len = pk_len;
-                }
+                // tx_view_alloc clamped the lengths to the scheme maxima
+                if (tx->sig_len > 0)
+                    memcpy(tx_view_signature(tx), pt->signature.data, tx->sig_len);
+                if (tx->pubkey_len > 0)
+                    memcpy(tx_view_public_key(tx), pt->public_key.data, tx->pubkey_len);
                 tx->sig_type = pt->sig_type ? (uint8_t)pt->sig_type : SIG_ED25519;
                 txs[tx_count++] = tx;
             }
@@ -505,12 +614,15 @@ bool validator_create_and_submit_block(Validator* v) {
         memcpy(&expected, buffer + 4, 4);
         uint8_t* tx_data = (uint8_t*)(buffer + 8);
         size_t available_bytes = size - 8;
+        Transaction* tmp = safe_malloc(sizeof(Transaction));
         for (uint32_t i = 0; i < expected && i < max_txs_per_block; i++) {
             if ((i + 1) * sizeof(Transaction) > available_bytes) break;
-            Transaction* tx = safe_malloc(sizeof(Transaction));
-            memcpy(tx, tx_data + i * sizeof(Transaction), sizeof(Transaction));
-            txs[tx_count++] = tx;
+            memcpy(tmp, tx_data + i * sizeof(Transaction), sizeof(Transaction));
+            if (tmp->sig_len > CRYPTO_SIG_MAX) tmp->sig_len = CRYPTO_SIG_MAX;
+            if (tmp->pubkey_len > CRYPTO_PUBKEY_MAX) tmp->pubkey_len = CRYPTO_PUBKEY_MAX;
+            txs[tx_count++] = tx_view_create(tx_arena, tmp);
         }
+        free(tmp);
     } else if (size <= 0) {
         LOG_WARN("   ├─ ⚠️  No response from pool");
     }
@@ -580,6 +692,8 @@ bool validator_create_and_submit_block(Validator* v) {
         LOG_ERROR("[%s] Failed to create block", v->name);
         if (diag_t0) free(diag_t0);
         if (diag_t1) free(diag_t1);
+        if (preverified) free(preverified);
+        tx_arena_destroy(tx_arena);
         free(buffer); free(txs);
         return false;
     }
@@ -592,9 +706,9 @@ bool validator_create_and_submit_block(Validator* v) {
     memcpy(block->header.challenge_hash, v->current_challenge.challenge_hash, 32);
     memcpy(block->header.farmer_address, v->wallet->address, 20);
     
-    SpaceProof* proof = plot_find_proof(v->plot, 
-                                        v->current_challenge.challenge_hash,
-                                        v->current_challenge.current_difficulty);
+    SpaceProof* proof = plot_find_proof_many(v->plots, v->plot_count,
+                                             v->current_challenge.challenge_hash,
+                                             v->current_challenge.current_difficulty);
     if (proof) {
         memcpy(block->header.proof_hash, proof->proof_hash, 28);
         block->header.proof_nonce = proof->nonce;
@@ -621,17 +735,21 @@ bool validator_create_and_submit_block(Validator* v) {
         LOG_ERROR("[%s] Failed to create coinbase", v->name);
         if (diag_t0) free(diag_t0);
         if (diag_t1) free(diag_t1);
+        if (preverified) free(preverified);
         block_destroy(block); free(buffer);
-        for (uint32_t i = 0; i < tx_count; i++) if (txs[i]) transaction_destroy(txs[i]);
+        tx_arena_destroy(tx_arena);
         free(txs);
         return false;
     }
+    // Room for the coinbase plus every fetched TX: no regrow in the loop
+    block_reserve(block, tx_count + 1 < MAX_TRANSACTIONS_PER_BLOCK
+                             ? tx_count + 1 : MAX_TRANSACTIONS_PER_BLOCK);
     block_add_transaction(block, coinbase_placeholder);  // index 0
     transaction_destroy(coinbase_placeholder);
     
     // ─── STEP 4b: BATCH PROCESSING LOOP ─────────────────────────────────
     // For each batch of VERIFY_BATCH_SIZE TXs:
-    //   Phase A: PARALLEL Ed25519 signature verification (OpenMP)
+    //   Phase A: PARALLEL signature verification (OpenMP + crypto_verify_many)
     //            Each TX independently verifiable — embarrassingly parallel.
     //            If pubkey available: full Ed25519 verify (recompute hash, check sig)
     //            If no pubkey: basic sanity check (non-zero sig)
@@ -653,6 +771,7 @@ bool validator_create_and_submit_block(Validator* v) {
     uint64_t total_fees = 0;
     uint32_t batches_processed = 0;
     uint32_t sig_failures = 0;
+    uint32_t sigs_verified = 0;
     uint32_t balance_failures = 0;
     uint64_t total_sig_ms = 0;
     bool deadline_stopped = false;
@@ -696,35 +815,51 @@ bool validator_create_and_submit_block(Validator* v) {
         // ──────────────────────────────────────────────────────────────
         // Each TX can be verified independently:
         //   1. TX carries its own pubkey + sig_type inline (no separate array)
-        //   2. transaction_verify() dispatches by tx->sig_type via crypto_backend
-        //   3. Recompute tx_hash = BLAKE3(nonce||expiry||src||dst||value||fee)
-        //   4. crypto_verify_typed(sig_type, pubkey, tx_hash, signature)
+        //   2. Recompute tx_hash = BLAKE3(nonce||expiry||src||dst||value||fee)
+        //   3. crypto_verify_many() over the thread's slice of the batch
+        //
+        // Each thread takes one contiguous slice and verifies it with a single
+        // transaction_verify_batch() call, so per-call setup (digest ctx,
+        // decoded pubkey, OQS verifier) is paid once per slice / sender run
+        // instead of once per TX. Slices stay contiguous because the pool
+        // returns TXs grouped by sender.
         //
         // With 8 OpenMP threads and 1000 TXs per batch:
         //   125 TXs/thread × ~0.06ms/verify = ~7.5ms per batch (Ed25519)
         //   Falcon-512 and ML-DSA-44 are faster on modern hardware.
+        //
+        // With --trust-pool-verify and a TXTV reply, TXs the pool verified
+        // at admission are accepted here without re-verification.
         // ──────────────────────────────────────────────────────────────
-        memset(batch_valid, 1, batch_size);
         uint32_t batch_sig_fail = 0;
+        uint32_t batch_verified = 0;
         uint64_t sig_start = get_current_time_ms();
         uint64_t* batch_t3 = safe_malloc(batch_size * sizeof(uint64_t));
 
-        #pragma omp parallel for schedule(static) reduction(+:batch_sig_fail)
-        for (uint32_t bi = 0; bi < batch_size; bi++) {
-            uint32_t i = batch_start + bi;
-            Transaction* tx = txs[i];
-            if (!tx) { batch_valid[bi] = 0; batch_sig_fail++; batch_t3[bi] = 0; continue; }
+        #pragma omp parallel reduction(+:batch_sig_fail, batch_verified)
+        {
+            uint32_t nth = (uint32_t)omp_get_num_threads();
+            uint32_t tid = (uint32_t)omp_get_thread_num();
+            uint32_t lo = (uint32_t)((uint64_t)batch_size * tid / nth);
+            uint32_t hi = (uint32_t)((uint64_t)batch_size * (tid + 1) / nth);
+            uint32_t first = batch_start + lo;
 
-            // TX carries its own pubkey inline — dispatch by sig_type
-            if (!transaction_verify(tx)) {
-                batch_valid[bi] = 0;
-                batch_sig_fail++;
+            if (hi > lo)
+                batch_verified += verify_slice(
+                    &txs[first], hi - lo,
+                    preverified ? preverified + first : NULL,
+                    preverified && diag_ts_count > first ? diag_ts_count - first : 0,
+                    &batch_valid[lo]);
+            uint64_t t3 = get_current_time_ns();
+            for (uint32_t bi = lo; bi < hi; bi++) {
+                batch_t3[bi] = txs[batch_start + bi] ? t3 : 0;
+                if (!batch_valid[bi]) batch_sig_fail++;
             }
-            batch_t3[bi] = get_current_time_ns();
         }
 
         total_sig_ms += get_current_time_ms() - sig_start;
         sig_failures += batch_sig_fail;
+        sigs_verified += batch_verified;
 
         // Write per-TX diagnostics for this batch; track t3_last
 #ifndef DIAG_OFF
@@ -734,7 +869,7 @@ bool validator_create_and_submit_block(Validator* v) {
             char src_hex[41];
             for (uint32_t bi = 0; bi < batch_size; bi++) {
                 uint32_t i = batch_start + bi;
-                Transaction* tx = txs[i];
+                TxView* tx = txs[i];
                 if (!tx) continue;
                 size_t tx_bytes = 64 + tx->sig_len + tx->pubkey_len;
                 uint64_t t0 = (diag_t0 && i < diag_ts_count) ? diag_t0[i] : 0;
@@ -762,7 +897,7 @@ bool validator_create_and_submit_block(Validator* v) {
             if (!batch_valid[bi]) continue;
             
             uint32_t i = batch_start + bi;
-            Transaction* tx = txs[i];
+            TxView* tx = txs[i];
             
             // Block full?
             if (block->header.transaction_count >= MAX_TRANSACTIONS_PER_BLOCK) {
@@ -789,8 +924,8 @@ bool validator_create_and_submit_block(Validator* v) {
             }
             cached_balances[sender_idx] -= required;
             
-            // Add to block (block_add_transaction copies the TX)
-            if (!block_add_transaction(block, tx)) {
+            // Add to block (copied into the block's own arena)
+            if (!block_add_tx_view(block, tx)) {
                 block_full = true;
                 break;
             }
@@ -809,6 +944,21 @@ bool validator_create_and_submit_block(Validator* v) {
              block_full ? ", PARTIAL:block_full" : "");
     if (sig_failures || balance_failures)
         LOG_INFO("   ├─ ⚠️  Rejected: %u sig, %u balance", sig_failures, balance_failures);
+    if (preverified)
+        LOG_INFO("   ├─ ✅ Pool pre-verified: verified %u sigs locally, skipped the rest",
+                 sigs_verified);
+    {
+        uint64_t pk_hits = 0, pk_misses = 0;
+        crypto_pubkey_cache_stats(&pk_hits, &pk_misses);
+        if (pk_hits + pk_misses > 0)
+            LOG_INFO("   ├─ 🔑 Pubkey cache: %lu hits / %lu misses (%.1f%% hit rate, cumulative)",
+                     pk_hits, pk_misses, 100.0 * pk_hits / (pk_hits + pk_misses));
+        uint64_t sc_hits = 0, sc_misses = 0;
+        sig_cache_get_stats(&sc_hits, &sc_misses);
+        if (sc_hits + sc_misses > 0)
+            LOG_INFO("   ├─ ♻️  Sig cache: %lu hits / %lu misses (%.1f%% hit rate, cumulative)",
+                     sc_hits, sc_misses, 100.0 * sc_hits / (sc_hits + sc_misses));
+    }
     
     // =========================================================================
     // STEP 5: UPDATE coinbase at index 0 with real accumulated fees
@@ -818,9 +968,11 @@ bool validator_create_and_submit_block(Validator* v) {
     // The coinbase is at block->transactions[0] (a copy made by block_add_transaction).
     if (block->transactions[0] && total_fees > 0) {
         block->transactions[0]->value = mining_reward + total_fees;
+        block_tx_changed(block, 0);
     }
     
     block->total_fees = total_fees;
+    block_compact(block);   // sized for every candidate TX until now
     block_calculate_hash(block);
     
     char block_hash_hex[65];
@@ -840,8 +992,9 @@ bool validator_create_and_submit_block(Validator* v) {
         LOG_ERROR("[%s] Failed to serialize block", v->name);
         if (diag_t0) free(diag_t0);
         if (diag_t1) free(diag_t1);
+        if (preverified) free(preverified);
         block_destroy(block); free(buffer);
-        for (uint32_t i = 0; i < tx_count; i++) if (txs[i]) transaction_destroy(txs[i]);
+        tx_arena_destroy(tx_arena);
         free(txs);
         return false;
     }
@@ -925,8 +1078,8 @@ bool validator_create_and_submit_block(Validator* v) {
     // Cleanup
     if (diag_t0) free(diag_t0);
     if (diag_t1) free(diag_t1);
-    for (uint32_t i = 0; i < tx_count; i++)
-        if (txs[i]) transaction_destroy(txs[i]);
+    if (preverified) free(preverified);
+    tx_arena_destroy(tx_arena);
     block_destroy(block);
     free(buffer);
     free(txs);
@@ -1036,12 +1189,19 @@ void validator_set_max_txs_per_block(uint32_t max_txs) {
 #else
     size_t bytes_per_tx = 216;    /* Ed25519: pubkey=32 + sig=64 + overhead */
 #endif
-    size_t needed = (size_t)max_txs_per_block * (bytes_per_tx + 16) + 8;
+    // + 17: TXTS timestamps (16 B) + TXTV pre-verified flag (1 B) per TX
+    size_t needed = (size_t)max_txs_per_block * (bytes_per_tx + 17) + 8;
     if (needed < VALIDATOR_BASE_BUFFER_SIZE) needed = VALIDATOR_BASE_BUFFER_SIZE;
     validator_buffer_size = needed;
     LOG_INFO("MAX_TXS_PER_BLOCK set to %u (buffer: %zu bytes)", max_txs_per_block, validator_buffer_size);
 }
 
+void validator_set_trust_pool_verify(bool enabled) {
+    trust_pool_verify = enabled;
+    if (enabled)
+        LOG_INFO("Trusting pool admission verify (skipping sig check for pre-verified TXs)");
+}
+
 // =============================================================================
 // STATISTICS
 // =============================================================================
@@ -1070,7 +1230,12 @@ void validator_destroy(Validator* v) {
     if (v->blockchain_req) zmq_close(v->blockchain_req);
     if (v->zmq_context) zmq_ctx_destroy(v->zmq_context);
     if (v->wallet) wallet_destroy(v->wallet);
-    if (v->plot) plot_destroy(v->plot);
-    
+    for (uint32_t i = 0; i < v->plot_count; i++) plot_destroy(v->plots[i]);
+    free(v->plots);
+
+    // Release the per-thread verifier contexts cached by the Phase A workers
+    #pragma omp parallel
+    crypto_thread_cleanup();
+
     free(v);
 }
@@ -81,6 +81,13 @@ Validator Options:
                             K=20: 1M entries (~32MB, moderate)
                             K=22: 4M entries (~128MB, slower)
   --num-farmers N           Number of farmers (default: $NUM_FARMERS)
+  --verify-admission        Pool verifies signatures on submit; validators
+                            skip sig checks for pre-verified TXs
+  --fee-priority            Pool hands out TXs by fee per byte instead of
+                            sender address order
+  --block-store DIR         Blockchain keeps only recent blocks in memory,
+                            older ones in segment files under DIR; a
+                            restart resumes the chain stored there
 
 Other Options:
   --build-dir DIR           Build directory (default: $BUILD_DIR)
@@ -114,6 +121,9 @@ while [[ $# -gt 0 ]]; do
         --halving-interval) HALVING_INTERVAL="$2"; shift 2 ;;
         --k-param) K_PARAM="$2"; shift 2 ;;
         --num-farmers) NUM_FARMERS="$2"; shift 2 ;;
+        --verify-admission) VERIFY_ADMISSION=1; shift ;;
+        --fee-priority) FEE_PRIORITY=1; shift ;;
+        --block-store) BLOCK_STORE_DIR="$2"; shift 2 ;;
         --build-dir) BUILD_DIR="$2"; shift 2 ;;
         --session) SESSION_NAME="$2"; shift 2 ;;
         -h|--help) show_help; exit 0 ;;
@@ -265,12 +275,12 @@ echo ""
 # Create new tmux session with blockchain window
 # Window 0: Blockchain Server
 tmux new-session -d -s $SESSION_NAME -n "blockchain"
-tmux send-keys -t $SESSION_NAME:0 "$BUILD_DIR/blockchain tcp://*:$BLOCKCHAIN_PORT --metronome-notify tcp://localhost:$METRONOME_NOTIFY_PORT --pub tcp://*:$BLOCKCHAIN_PUB_PORT" C-m
+tmux send-keys -t $SESSION_NAME:0 "$BUILD_DIR/blockchain tcp://*:$BLOCKCHAIN_PORT --metronome-notify tcp://localhost:$METRONOME_NOTIFY_PORT --pub tcp://*:$BLOCKCHAIN_PUB_PORT${BLOCK_STORE_DIR:+ --block-store $BLOCK_STORE_DIR}" C-m
 
 # Window 1: Transaction Pool
 tmux new-window -t $SESSION_NAME -n "pool"
 sleep 0.5
-tmux send-keys -t $SESSION_NAME:1 "$BUILD_DIR/pool tcp://*:$POOL_PORT --sub tcp://localhost:$BLOCKCHAIN_PUB_PORT --pub tcp://*:$POOL_PUB_PORT" C-m
+tmux send-keys -t $SESSION_NAME:1 "$BUILD_DIR/pool tcp://*:$POOL_PORT --sub tcp://localhost:$BLOCKCHAIN_PUB_PORT --pub tcp://*:$POOL_PUB_PORT${VERIFY_ADMISSION:+ --verify-admission}${FEE_PRIORITY:+ --fee-priority}" C-m
 
 # Window 2: Metronome
 tmux new-window -t $SESSION_NAME -n "metronome"
@@ -310,6 +320,9 @@ VALIDATOR_OPTS="$VALIDATOR_OPTS -k $K_PARAM"
 if [ -n "${MAX_TXS_PER_BLOCK:-}" ]; then
     VALIDATOR_OPTS="$VALIDATOR_OPTS --max-txs $MAX_TXS_PER_BLOCK"
 fi
+if [ -n "${VERIFY_ADMISSION:-}" ]; then
+    VALIDATOR_OPTS="$VALIDATOR_OPTS --trust-pool-verify"
+fi
 
 # Start first farmer
 tmux send-keys -t $SESSION_NAME:3 "$BUILD_DIR/validator farmer1 $VALIDATOR_OPTS" C-m